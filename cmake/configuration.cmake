@@ -9,9 +9,13 @@ if (TARGET tdl)
 endif ()
 
 option (INSTALL_TDL "Enable installation of TDL. (Projects embedding TDL may want to turn this OFF.)" ON)
+option (TDL_CWL_INLINE_FIELDS "Store fields of the CWL structs inline, only recursive fields on the heap." ON)
+option (TDL_CWL_COMPILED "Compile the serialisation of the CWL structs into tdl, cwl_v1_2.h only declares it." ON)
 
 include (${tdl_SOURCE_DIR}/cmake/CPM.cmake)
+include (${tdl_SOURCE_DIR}/cmake/version.cmake)
 
+# The direct CWL writer (src/tdl/yamlWriter.cpp) quotes strings like the emitter of this version.
 set (TDL_YAML_CPP_VERSION "0.8.0" CACHE STRING "Version of yaml-cpp to use.")
 
 CPMAddPackage (
@@ -29,11 +33,36 @@ CPMAddPackage (
             "BUILD_TESTING OFF" # Disables CMake/CTest/CDash targets (Continuous, Experimental, Nightly, etc.).
 )
 
-add_library (tdl STATIC ${tdl_SOURCE_DIR}/src/tdl/convertToCTD.cpp ${tdl_SOURCE_DIR}/src/tdl/convertToCWL.cpp)
+find_package (Threads REQUIRED)
+
+add_library (tdl STATIC
+             ${tdl_SOURCE_DIR}/src/tdl/cliMappingIndex.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/conversionCache.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/convertAll.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/convertToCTD.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/convertToCWL.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/convertToString.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/cwl_v1_2.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/escapeXML.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/fingerprint.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/flatTree.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/jsonWriter.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/mappedFile.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/parseCTD.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/pathIndex.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/pmr.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/validate.cpp
+             ${tdl_SOURCE_DIR}/src/tdl/yamlWriter.cpp)
 target_include_directories (tdl PUBLIC "$<BUILD_INTERFACE:${tdl_SOURCE_DIR}/src>"
                                        "$<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>")
-target_link_libraries (tdl PUBLIC yaml-cpp::yaml-cpp)
+target_link_libraries (tdl PUBLIC yaml-cpp::yaml-cpp Threads::Threads)
 target_compile_features(tdl PUBLIC cxx_std_17)
+# the version is part of the keys of ConversionCache
+target_compile_definitions (tdl PRIVATE TDL_VERSION="${TDL_VERSION}")
+# changes the layout of the CWL structs, so tdl and all code using it must agree on it
+target_compile_definitions (tdl PUBLIC TDL_CWL_INLINE_FIELDS=$<BOOL:${TDL_CWL_INLINE_FIELDS}>)
+# code including cwl_v1_2.h must know whether tdl defines the serialisation or the header has to
+target_compile_definitions (tdl PUBLIC TDL_CWL_COMPILED=$<BOOL:${TDL_CWL_COMPILED}>)
 add_library (tdl::tdl ALIAS tdl)
 
 if (INSTALL_TDL)
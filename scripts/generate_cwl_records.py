@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""Generates the per record functions of cwl_v1_2_stream.h and cwl_v1_2_json.h.
+
+Usage: generate_cwl_records.py <directory with the headers, e.g. src/tdl>
+
+The record readers of cwl_v1_2_stream.h follow the fromYaml functions of cwl_v1_2_impl.h field by field, the
+variant detection follows DetectAndExtractFromYaml. The record writers of cwl_v1_2_json.h follow the toYaml
+functions. Both headers are rewritten in place between their markers, run this after postprocess_cwl.py.
+"""
+
+import re
+import sys
+from pathlib import Path
+
+FORWARD = '// forward declarations, the records refer to each other\n'
+STREAM_BEGIN = '// the records, generated by scripts/generate_cwl_records.py from the fromYaml functions\n'
+JSON_BEGIN = '// the records, generated by scripts/generate_cwl_records.py from the toYaml functions\n'
+END = '// end of the generated records\n'
+
+
+def short(name):
+    return name.replace('w3id_org::cwl::', '')
+
+
+class Records:
+    """The structs of cwl_v1_2.h and their serialisation in cwl_v1_2_impl.h, in the order of the header."""
+
+    def __init__(self, header, impl):
+        self.fields = {}  # struct -> (bases, {field: type})
+        struct_re = r'namespace (w3id_org::cwl::\w+) \{\nstruct (\w+)((?:\n\s*: [^{]*)?) \{\n(.*?)\n\};'
+        for match in re.finditer(struct_re, header, re.S):
+            namespace, name, bases, body = match.groups()
+            bases = [base.strip().lstrip(': ').strip() for base in bases.replace(':', ' ', 1).split(',')]
+            fields = dict((field, type) for type, field in
+                          re.findall(r'(?m)^    (?:field|heap)_object<(.*)> (\w+);$', body))
+            self.fields[namespace + '::' + name] = ([base for base in bases if base], fields)
+
+        constants = re.findall(r'template <> struct IsConstant<w3id_org::cwl::\w+::(\w+)> : std::true_type', header)
+
+        self.order = []
+        self.reads = {}  # struct -> (bases, [(key, subject, predicate, expand type, field)])
+        from_yaml_re = (r'TDL_CWL_INLINE void (w3id_org::cwl::\w+::\w+)::fromYaml\(\[\[maybe_unused\]\] '
+                        r'YAML::Node const& n\) \{\n(.*?)\n\}\n')
+        for match in re.finditer(from_yaml_re, impl, re.S):
+            name, body = match.groups()
+            bases = re.findall(r'(?m)^    (w3id_org::\S+)::fromYaml\(n\);$', body)
+            fields = re.findall(r'convertMapToList\(n\["([^"]+)"\], "([^"]*)", "([^"]*)"\);\n'
+                                r'\s*auto expandedNode = (expandType)?\(nodeAsList\);\n'
+                                r'\s*fromYaml\(expandedNode, \*(\w+)\);', body)
+            if body.count('auto nodeAsList') != len(fields):
+                raise SystemExit(f'unknown field in {name}::fromYaml')
+            self.order.append(name)
+            self.reads[name] = (bases, fields)
+
+        self.detects = {}  # struct -> [(key, field)] of its constant fields
+        detect_re = (r'TDL_CWL_INLINE auto DetectAndExtractFromYaml<::(w3id_org::cwl::\w+::\w+)>::operator\(\)'
+                     r'.*? \{\n(.*?)\n\}\n')
+        for match in re.finditer(detect_re, impl, re.S):
+            name, body = match.groups()
+            keys = re.findall(r'tryFromYaml\(n\["([^"]+)"\], \*res\.(\w+)\)', body)
+            keys = [(key, field) for key, field in keys
+                    if self.field_type(name, field).strip().split('::')[-1] in constants]
+            if keys:
+                self.detects[name] = keys
+
+        self.writes = {}  # struct -> (bases, [(field, key)])
+        to_yaml_re = (r'TDL_CWL_INLINE auto (w3id_org::cwl::\w+::\w+)::toYaml\(\[\[maybe_unused\]\] '
+                      r'::w3id_org::cwl::store_config const& config\) const -> YAML::Node \{\n(.*?)\n\}\n')
+        for match in re.finditer(to_yaml_re, impl, re.S):
+            name, body = match.groups()
+            bases = re.findall(r'n = mergeYaml\(n, (w3id_org::\S+)::toYaml\(config\)\);', body)
+            fields = re.findall(r'auto member = toYaml\(\*(\w+), config\);.*?addYamlField\(n, "([^"]+)", member\);',
+                                body, re.S)
+            if body.count('addYamlField') != len(fields):
+                raise SystemExit(f'unknown field in {name}::toYaml')
+            self.writes[name] = (bases, fields)
+
+        if not self.order or set(self.order) != set(self.writes):
+            raise SystemExit('fromYaml and toYaml functions do not match, has the generated header changed?')
+
+    def field_type(self, struct, field):
+        bases, fields = self.fields[struct]
+        if field in fields:
+            return fields[field]
+        for base in bases:
+            type = self.field_type(base, field)
+            if type is not None:
+                return type
+        return None
+
+    def keys(self, name):
+        """the keys toYaml writes, like mergeYaml at the position of the first base, the last value wins"""
+        bases, fields = self.writes[name]
+        keys = {}
+        for base in bases:
+            for key, owners in self.keys(base).items():
+                keys.setdefault(key, []).extend(owners)
+        for field, key in fields:
+            keys.setdefault(key, []).append((name, field))
+        return keys
+
+
+def stream_records(records):
+    forward = [FORWARD]
+    forward += [f'inline auto readFields(NodeRef const & n, {short(name)} & out) -> bool;\n' for name in records.order]
+    forward += [f'inline auto detect(NodeRef const & n, std::optional<{short(name)}> & out) -> bool;\n'
+                for name in records.order if name in records.detects]
+
+    out = [STREAM_BEGIN]
+    for name in records.order:
+        bases, fields = records.reads[name]
+        parts = [f'readFields(n, static_cast<{short(base)} &>(out))' for base in bases]
+        parts += [f'readField(n, "{key}", "{subject}", "{predicate}", {"true" if expand else "false"}, *out.{field})'
+                  for key, subject, predicate, expand, field in fields]
+        if parts:
+            out.append(f'inline auto readFields(NodeRef const & n, {short(name)} & out) -> bool {{\n')
+            out.append('    return ' + '\n           && '.join(parts) + ';\n')
+        else:
+            out.append(f'inline auto readFields(NodeRef const &, {short(name)} &) -> bool {{\n')
+            out.append('    return true;\n')
+        out.append('}\n\n')
+    for name in records.order:
+        if name not in records.detects:
+            continue
+        out.append(f'inline auto detect(NodeRef const & n, std::optional<{short(name)}> & out) -> bool {{\n'
+                   '    if (n.type() != NodeType::Map) {\n'
+                   '        return true;\n'
+                   '    }\n'
+                   f'    auto res = {short(name)}{{}};\n')
+        for key, field in records.detects[name]:
+            out.append(f'    if (readConstant(n, "{key}", *res.{field}) && readFields(n, res)) {{\n'
+                       '        out = std::move(res);\n'
+                       '        return true;\n'
+                       '    }\n')
+        out.append('    return true;\n}\n\n')
+    return ''.join(forward), ''.join(out)
+
+
+def json_records(records):
+    forward = [FORWARD]
+    forward += [f'inline void writeFields(JSONWriter & writer, {short(name)} const & value);\n'
+                for name in records.order]
+
+    out = [JSON_BEGIN]
+    for name in records.order:
+        keys = records.keys(name)
+        if not keys:
+            out.append(f'inline void writeFields(JSONWriter &, {short(name)} const &) {{}}\n\n')
+            continue
+        out.append(f'inline void writeFields(JSONWriter & writer, {short(name)} const & value) {{\n')
+        for key, owners in keys.items():
+            if len(owners) == 1:
+                out.append(f'    writeField(writer, "{key}", *value.{owners[0][1]});\n')
+                continue
+            values = [f'               *static_cast<{short(owner)} const &>(value).{field}' for owner, field in owners]
+            out.append('    writeField(writer,\n'
+                       f'               "{key}",\n' + ',\n'.join(values) + ');\n')
+        out.append('}\n\n')
+    return ''.join(forward), ''.join(out)
+
+
+def replace_region(text, begin, end, generated, path):
+    start = text.find(begin)
+    stop = text.find(end, start)
+    if start < 0 or stop < 0:
+        raise SystemExit(f'{path}: markers not found')
+    return text[:start] + generated + text[stop:]
+
+
+def update(path, forward, records):
+    text = path.read_text()
+    text = replace_region(text, FORWARD, '\n\n', forward.rstrip('\n'), path)
+    text = replace_region(text, records.split('\n', 1)[0], END, records, path)
+    path.write_text(text)
+
+
+def main():
+    if len(sys.argv) != 2:
+        raise SystemExit(__doc__)
+    directory = Path(sys.argv[1])
+    records = Records((directory / 'cwl_v1_2.h').read_text(), (directory / 'cwl_v1_2_impl.h').read_text())
+    update(directory / 'cwl_v1_2_stream.h', *stream_records(records))
+    update(directory / 'cwl_v1_2_json.h', *json_records(records))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""Applies tdl's changes to the CWL header generated by cwl-cpp-auto.
+
+Usage: postprocess_cwl.py <generated cwl_v1_2.h> <output directory, e.g. src/tdl>
+
+The generated header is not edited by hand, each change is a step of this script:
+ - detection without exceptions: variant alternatives are selected by `tryFromYaml` on their constant fields
+ - inline fields: fields that do not refer to their own struct or a later one are `field_object`s
+ - double formatting: `store_config::formatDouble` sets the text of finite doubles written by toYaml
+ - split: the serialisation is declared in cwl_v1_2.h and defined in cwl_v1_2_impl.h, see TDL_CWL_COMPILED
+"""
+
+import re
+import sys
+from pathlib import Path
+
+
+def replace_once(text, old, new):
+    if old not in text:
+        raise SystemExit(f'generated header has changed, not found:\n{old}')
+    return text.replace(old, new, 1)
+
+
+def replace_all(pattern, replacement, text, what):
+    text, count = re.subn(pattern, replacement, text)
+    if count == 0:
+        raise SystemExit(f'generated header has changed, no {what} found')
+    return text
+
+
+def detect_without_throwing(text):
+    """Selects variant alternatives without throwing exceptions.
+
+    Scalars are decoded by YAML::convert instead of catching YAML::BadConversion. Every enum gets a
+    `try_to_enum` and a `tryFromYaml`, a record is only parsed once its constant field matches.
+    """
+    text = replace_once(text, '''template <typename S>
+struct DetectAndExtractFromYaml_implScalar {
+    auto operator()(YAML::Node const& n) const -> std::optional<S> {
+        try {
+            if (n.IsScalar()) return n.as<S>();
+        } catch(...) {}
+        return std::nullopt;
+    }
+};''', '''// decodes without throwing, a scalar of another kind is rejected by YAML::convert
+template <typename S>
+struct DetectAndExtractFromYaml_implScalar {
+    auto operator()(YAML::Node const& n) const -> std::optional<S> {
+        if (!n.IsDefined() || !n.IsScalar()) return std::nullopt;
+        auto res = S{};
+        if (!YAML::convert<S>::decode(n, res)) return std::nullopt;
+        return res;
+    }
+};''')
+
+    text = replace_once(text, '''template <typename T> struct IsConstant : std::false_type {};
+''', '''template <typename T> struct IsConstant : std::false_type {};
+
+// checks and reads a constant field without throwing, only constants (enums) can match
+template <typename T>
+auto tryFromYaml(YAML::Node const&, T&) -> bool {
+    return false;
+}
+''')
+
+    def try_to_enum(match):
+        return f'''inline auto try_to_enum(std::string_view v, {match[1]}& out) -> bool {{
+{match[2]}    if (iter == m.end()) return false;
+    out = iter->second;
+    return true;
+}}
+inline void to_enum(std::string_view v, {match[1]}& out) {{
+    if (!try_to_enum(v, out)) throw bool{{}};
+}}'''
+    text = replace_all(r'''inline void to_enum\(std::string_view v, ([\w:]+)& out\) \{
+(    static auto m = std::map<[^\n]*\n(?:        [^\n]*\n)*    \};
+    auto iter = m.find\(v\);
+)    if \(iter == m.end\(\)\) throw bool\{\};
+    out = iter->second;
+\}''', try_to_enum, text, 'to_enum')
+
+    def enum_try_from_yaml(match):
+        return match[0] + f'''inline auto tryFromYaml(YAML::Node const& n, {match[1]}& out) -> bool {{
+    if (!n.IsDefined() || !n.IsScalar()) return false;
+    return try_to_enum(n.Scalar(), out);
+}}
+'''
+    text = replace_all(r'''inline void fromYaml\(YAML::Node n, ([\w:]+)& out\) \{
+    to_enum\(n.as<std::string>\(\), out\);
+\}
+''', enum_try_from_yaml, text, 'enum fromYaml')
+
+    def record_detection(match):
+        return f'''        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.{match[1]})::value_t>::value) {{
+            if (tryFromYaml(n["{match[2]}"], *res.{match[1]})) try {{
+                fromYaml(n, res);
+                return res;
+            }} catch(...) {{}}
+        }}
+'''
+    text = replace_all(r'''        if constexpr \(::w3id_org::cwl::IsConstant<decltype\(res\.(\w+)\)::value_t>::value\) try \{
+            fromYaml\(n\["(\w+)"\], \*res\.\1\);
+            fromYaml\(n, res\);
+            return res;
+        \} catch\(\.\.\.\) \{\}
+''', record_detection, text, 'record detection')
+
+    # the functions at namespace scope are defined in a header, they have to be inline
+    return replace_all(r'(?m)^((?:auto|void) (?:load|store)_document\w*\()', r'inline \1', text, 'load/store_document')
+
+
+FIELD_OBJECT = '''// Fields that do not refer to their own struct or to a struct defined later are field_objects, the
+// others are heap_objects. With TDL_CWL_INLINE_FIELDS set to 0 every field is stored on the heap.
+#ifndef TDL_CWL_INLINE_FIELDS
+#define TDL_CWL_INLINE_FIELDS 1
+#endif
+
+#if TDL_CWL_INLINE_FIELDS
+template <typename T>
+class field_object {
+    T data{};
+
+public:
+    using value_t = T;
+    field_object() = default;
+    field_object(field_object const&) = default;
+    field_object(field_object&&) = default;
+
+    template <typename T2, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T2>, field_object>>>
+    field_object(T2&& oth) noexcept(noexcept(data = std::forward<T2>(oth))) {
+        data = std::forward<T2>(oth);
+    }
+
+    auto operator=(field_object const&) -> field_object& = default;
+    auto operator=(field_object&&) -> field_object& = default;
+
+    template <typename T2, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T2>, field_object>>>
+    auto operator=(T2&& oth) noexcept(noexcept(data = std::forward<T2>(oth))) -> field_object& {
+        data = std::forward<T2>(oth);
+        return *this;
+    }
+
+    auto operator->() noexcept(true) -> T* {
+        return &data;
+    }
+    auto operator->() const noexcept(true) -> T const* {
+        return &data;
+    }
+    auto operator*() noexcept(true) -> T& {
+        return data;
+    }
+    auto operator*() const noexcept(true) -> T const& {
+        return data;
+    }
+};
+#else
+template <typename T>
+using field_object = heap_object<T>;
+#endif
+'''
+
+
+def inline_fields(text):
+    """Stores fields inline as `field_object` instead of on the heap as `heap_object`.
+
+    A field stays a heap_object if its type refers to its own struct or to a struct defined later in the
+    header, an inline member of an incomplete type would not compile. With TDL_CWL_INLINE_FIELDS set to 0,
+    field_object is an alias of heap_object.
+    """
+    text = replace_once(text, '#include <map>\n#include <optional>\n',
+                        '#include <map>\n#include <memory>\n#include <optional>\n')
+    text = replace_once(text, '#include <string_view>\n#include <variant>\n',
+                        '#include <string_view>\n#include <type_traits>\n#include <variant>\n')
+    anchor = '        return *data;\n    }\n};\n\n}\nnamespace w3id_org::cwl::salad { struct Documented; }'
+    text = replace_once(text, anchor, anchor.replace('\n}\n', '\n' + FIELD_OBJECT + '\n}\n', 1))
+
+    structs = set(re.findall(r'(?m)^namespace w3id_org::cwl::\w+ \{ struct (\w+); \}$', text))
+    defined = set()
+    current = None
+    lines = text.split('\n')
+    for i, line in enumerate(lines):
+        match = re.match(r'struct (\w+)(\s*$|\s*\{|\s*:)', line)
+        if match and match[1] in structs:
+            current = match[1]
+            defined.add(current)
+        match = re.fullmatch(r'    heap_object<(.*)> \w+;', line)
+        if match and current:
+            refers = set(re.findall(r'\b\w+\b', match[1])) & structs
+            if current not in refers and refers <= defined:
+                lines[i] = line.replace('heap_object<', 'field_object<', 1)
+    return '\n'.join(lines)
+
+
+
+def format_doubles(text):
+    """Lets the caller format doubles written by toYaml, e.g. as shortest round trip text.
+
+    `store_config::formatDouble` is used for finite values, if it is unset yaml-cpp writes the double as before.
+    """
+    text = replace_once(text, '#include <cassert>\n', '#include <cassert>\n#include <cmath>\n')
+    text = replace_once(text, '''    bool generateTags = false;
+};''', '''    bool generateTags = false;
+    // formats finite doubles, e.g. shortest round trip text; if unset (or not finite) yaml-cpp writes them
+    std::string (*formatDouble)(double) = nullptr;
+};''')
+    return replace_once(text, '''inline auto toYaml(double v, [[maybe_unused]] store_config const&) { return YAML::Node{v}; }
+''', '''inline auto toYaml(double v, [[maybe_unused]] store_config const& config) {
+    if (config.formatDouble && std::isfinite(v)) return YAML::Node{config.formatDouble(v)};
+    return YAML::Node{v};
+}
+''')
+
+COMPILED = '''// With TDL_CWL_COMPILED set to 1 this header only declares the serialisation of the structs (toYaml, fromYaml,
+// the detection of variant alternatives and load/store_document), the definitions in cwl_v1_2_impl.h are compiled
+// once by cwl_v1_2.cpp. Otherwise they are included at the end of this header and defined inline.
+#ifndef TDL_CWL_COMPILED
+#define TDL_CWL_COMPILED 0
+#endif
+
+#if TDL_CWL_COMPILED
+#define TDL_CWL_INLINE
+#else
+#define TDL_CWL_INLINE inline
+#endif
+
+'''
+
+IMPL_HEADER = '''// SPDX-FileCopyrightText: Copyright 2016-2024 CWL Project Contributors
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+/* This file was generated using schema-salad code generator.
+ *
+ * The embedded document is subject to the license of the original schema.
+ */
+
+/* The definitions of the serialisation declared in cwl_v1_2.h
+ *
+ * Included at the end of cwl_v1_2.h, or compiled once by cwl_v1_2.cpp if TDL_CWL_COMPILED is set.
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include "cwl_v1_2.h"
+'''
+
+
+def index(lines, start, what, matches):
+    for i in range(start, len(lines)):
+        if matches(i):
+            return i
+    raise SystemExit(f'generated header has changed, no {what} found')
+
+
+def split(text):
+    """Splits the header into the declarations (cwl_v1_2.h) and the definitions (cwl_v1_2_impl.h).
+
+    The member functions, the detection of variant alternatives and load/store_document are defined with
+    TDL_CWL_INLINE, which is `inline` unless TDL_CWL_COMPILED is set and cwl_v1_2.cpp compiles them once.
+    """
+    lines = text.split('\n')
+    # the structs end with the destructor of heap_object, their member functions follow
+    structs_end = index(lines, 0, 'heap_object destructor',
+                        lambda i: lines[i] == 'template <typename T> heap_object<T>::~heap_object() = default;') + 2
+    templates = index(lines, structs_end, 'generic toYaml', lambda i: lines[i] == 'namespace w3id_org::cwl {'
+                      and lines[i + 2] == 'template <typename T>'
+                      and lines[i + 3].startswith('auto toYaml(std::vector<T> const& v,'))
+    root = index(lines, templates, 'DocumentRootType', lambda i: lines[i].startswith('using DocumentRootType = '))
+    if lines[structs_end] != '' or lines[-2:] != ['', '}']:
+        raise SystemExit('generated header has changed, unexpected layout')
+
+    header = replace_once('\n'.join(lines[:structs_end]), '// Fields that do not refer to their own struct',
+                          COMPILED + '// Fields that do not refer to their own struct').split('\n')
+
+    # detector specialisations are declared in the header, their operator() is defined out of line
+    defs = lines[structs_end + 1:templates]
+    decls = []
+    impl = []
+    i = 0
+    while i < len(defs):
+        match = i + 2 < len(defs) and re.fullmatch(r'struct DetectAndExtractFromYaml<(::[\w:]+)> \{', defs[i + 2])
+        if defs[i] == 'namespace w3id_org::cwl {' and defs[i + 1] == 'template <>' and match:
+            type = match[1]
+            signature = f'auto operator()(YAML::Node const& n) const -> std::optional<{type}>'
+            if defs[i + 3] != f'    {signature} {{':
+                raise SystemExit(f'generated header has changed, unexpected detection of {type}')
+            decls += [f'template <> struct DetectAndExtractFromYaml<{type}> {{', f'    {signature};', '};']
+            definition = signature.replace('operator()', f'DetectAndExtractFromYaml<{type}>::operator()', 1)
+            impl += ['namespace w3id_org::cwl {', f'TDL_CWL_INLINE {definition} {{']
+            j = i + 4
+            while defs[j] != '    }':
+                impl.append(defs[j][4:] if defs[j].startswith('    ') else defs[j])
+                j += 1
+            if defs[j + 1:j + 3] != ['};', '}']:
+                raise SystemExit(f'generated header has changed, unexpected detection of {type}')
+            impl += ['}', '}']
+            i = j + 3
+            continue
+        if defs[i].startswith('inline '):
+            impl.append('TDL_CWL_INLINE ' + defs[i][len('inline '):])
+        else:
+            impl.append(defs[i])
+        i += 1
+
+    # load/store_document are declared in the header, with their default arguments
+    load_store_decls = []
+    load_store = []
+    for line in lines[root + 1:-2]:
+        if line.startswith('inline '):
+            signature = line[len('inline '):].rstrip(' {')
+            load_store_decls.append(f'TDL_CWL_INLINE {signature};')
+            load_store.append('TDL_CWL_INLINE ' + signature.replace(' config={}', ' config') + ' {')
+        else:
+            load_store.append(line)
+
+    header += (['', '// the detection of structs as variant alternatives, defined with their fromYaml functions',
+                'namespace w3id_org::cwl {'] + decls + ['}', ''] + lines[templates:root + 1] + load_store_decls
+               + ['', '}', '', '#if !TDL_CWL_COMPILED', '#include "cwl_v1_2_impl.h"', '#endif', ''])
+    impl = IMPL_HEADER.split('\n') + impl + ['namespace w3id_org::cwl {', ''] + load_store + ['', '}', '']
+    return '\n'.join(header), '\n'.join(impl)
+
+
+def main():
+    if len(sys.argv) != 3:
+        raise SystemExit(__doc__)
+    text = Path(sys.argv[1]).read_text()
+    text = detect_without_throwing(text)
+    text = inline_fields(text)
+    text = format_doubles(text)
+    header, impl = split(text)
+    Path(sys.argv[2], 'cwl_v1_2.h').write_text(header)
+    Path(sys.argv[2], 'cwl_v1_2_impl.h').write_text(impl)
+
+
+if __name__ == '__main__':
+    main()
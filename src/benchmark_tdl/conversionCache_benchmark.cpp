@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+int main() {
+    // many tools of moderate size, as exported by a tool suite
+    auto docs = std::vector<tdl::ToolInfo>(300);
+    for (size_t t{0}; t < docs.size(); ++t) {
+        auto & doc                  = docs[t];
+        doc.metaInfo.name           = "tool" + std::to_string(t);
+        doc.metaInfo.executableName = doc.metaInfo.name;
+        for (size_t i{0}; i < 50; ++i) {
+            auto name = "parameter" + std::to_string(i);
+            doc.params.push_back({name, "a parameter with a description", {}, tdl::IntValue{1, 0, 100}});
+            doc.cliMapping.push_back({"--" + name, name});
+        }
+    }
+
+    auto directory = std::filesystem::temp_directory_path()
+                     / ("tdl_conversion_cache_benchmark_" + std::to_string(std::random_device{}()));
+    auto cache     = tdl::ConversionCache{directory};
+
+    constexpr size_t iterations = 5;
+
+    measure("convertToCTD and CWL, 300 tools", iterations, [&] {
+        for (auto const & doc : docs) {
+            doNotOptimize(tdl::convertToCTD(doc));
+            doNotOptimize(tdl::convertToCWL(doc, {}));
+        }
+    });
+
+    // the warm up call of measure fills the cache
+    measure("cached, 300 tools", iterations, [&] {
+        for (auto const & doc : docs) {
+            doNotOptimize(tdl::convertToCTD(doc, cache));
+            doNotOptimize(tdl::convertToCWL(doc, {}, cache));
+        }
+    });
+
+    std::filesystem::remove_all(directory);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+
+#include "utils.h"
+
+namespace {
+
+//!\brief a tool with a typical number of parameters and one nested record
+auto makeToolInfo() -> tdl::ToolInfo {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "tool";
+    doc.metaInfo.description    = "A tool with many parameters.";
+    doc.metaInfo.executableName = "tool";
+
+    auto record = tdl::Node{"options", "nested options", {}, tdl::Node::Children{}};
+    for (size_t i{0}; i < 60; ++i) {
+        auto name = "param" + std::to_string(i);
+        auto node = tdl::Node{name, "a parameter: with some description", {}, tdl::IntValue{}};
+        switch (i % 5) {
+        case 0: node.value = tdl::IntValue{5, 0, 10}; break;
+        case 1: node.value = tdl::DoubleValue{0.25, 0., 1.}; break;
+        case 2: node.value = tdl::StringValue{"in.fa"}; node.tags = {"file", "required"}; break;
+        case 3: node.value = tdl::StringValue{"out.fa"}; node.tags = {"output", "file"}; break;
+        default: node.value = tdl::DoubleValueList{{1.5, 2.5}}; break;
+        }
+        if (i % 6 == 0) {
+            std::get<tdl::Node::Children>(record.value).push_back(node);
+        } else {
+            doc.params.push_back(node);
+        }
+        doc.cliMapping.push_back({"--" + name, name});
+    }
+    doc.params.push_back(record);
+    return doc;
+}
+
+//!\brief a large tool, each parameter has its own command line option
+auto makeLargeToolInfo(size_t nbrOfParams) -> tdl::ToolInfo {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "large_tool";
+    doc.metaInfo.executableName = "large_tool";
+    for (size_t i{0}; i < nbrOfParams; ++i) {
+        auto name = "param" + std::to_string(i);
+        doc.params.push_back({name, "a parameter", {}, tdl::IntValue{static_cast<int>(i)}});
+        doc.cliMapping.push_back({"--" + name, name});
+    }
+    return doc;
+}
+
+} // namespace
+
+int main() {
+    auto doc = makeToolInfo();
+
+    constexpr size_t iterations = 1'000;
+
+    measure("convertToCWL, reference (YAML::Node)", iterations, [&] {
+        doNotOptimize(tdl::detail::convertToCWLReference(doc, {}));
+    });
+
+    measure("convertToCWL, direct writer", iterations, [&] {
+        doNotOptimize(tdl::convertToCWL(doc, {}));
+    });
+
+    auto large = makeLargeToolInfo(1'500);
+    measure("convertToCWL, 1500 parameters", 20, [&] {
+        doNotOptimize(tdl::convertToCWL(large, {}));
+    });
+
+    return EXIT_SUCCESS;
+}
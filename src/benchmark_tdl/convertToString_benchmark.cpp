@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tdl/convertToString.h>
+
+#include "utils.h"
+
+namespace {
+
+//!\brief previous implementation, a stream is constructed for every value
+template <typename T>
+auto convertToStringReference(T v) -> std::string {
+    auto ss = std::stringstream{};
+    ss << std::setprecision(std::numeric_limits<std::decay_t<T>>::max_digits10) << v;
+    return ss.str();
+}
+
+} // namespace
+
+int main() {
+    // a mass list, as it is found in OpenMS parameter files
+    auto rng    = std::mt19937_64{42};
+    auto dist   = std::uniform_real_distribution<double>{100., 2000.};
+    auto masses = std::vector<double>(10'000);
+    for (auto & m : masses) {
+        m = dist(rng);
+    }
+
+    constexpr size_t iterations = 100;
+
+    measure("convertToString (reference)", iterations, [&] {
+        for (auto m : masses) {
+            doNotOptimize(convertToStringReference(m));
+        }
+    });
+
+    measure("convertToString", iterations, [&] {
+        for (auto m : masses) {
+            doNotOptimize(tdl::detail::convertToString(m));
+        }
+    });
+
+    measure("formatNumber", iterations, [&] {
+        for (auto m : masses) {
+            doNotOptimize(tdl::detail::formatNumber(m).view());
+        }
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+
+#include <tdl/cwl_v1_2.h>
+#include <tdl/cwl_v1_2_json.h>
+
+#include "utils.h"
+
+namespace cwl = w3id_org::cwl::cwl;
+
+int main() {
+    auto info         = makeMixedToolInfo(500);
+    auto tool         = w3id_org::cwl::load_document_from_string(tdl::convertToCWL(info, {}));
+    auto workflow     = w3id_org::cwl::load_document_from_string(makeWorkflow(200));
+    auto toolJson     = w3id_org::cwl::store_document_as_json(tool);
+    auto workflowJson = w3id_org::cwl::store_document_as_json(workflow);
+    auto toolYaml     = w3id_org::cwl::store_document_as_string(tool);
+    auto workflowYaml = w3id_org::cwl::store_document_as_string(workflow);
+
+    constexpr size_t iterations = 10;
+
+    measure("load CommandLineTool, 500 parameters, YAML", iterations, [&] {
+        auto root = w3id_org::cwl::load_document_from_string(toolYaml);
+        doNotOptimize(*std::get<cwl::CommandLineTool>(root).inputs);
+    });
+
+    measure("load CommandLineTool, 500 parameters, JSON", iterations, [&] {
+        auto root = w3id_org::cwl::load_document_from_json(toolJson);
+        doNotOptimize(*std::get<cwl::CommandLineTool>(root).inputs);
+    });
+
+    measure("load Workflow, 200 steps, YAML", iterations, [&] {
+        auto root = w3id_org::cwl::load_document_from_string(workflowYaml);
+        doNotOptimize(*std::get<cwl::Workflow>(root).steps);
+    });
+
+    measure("load Workflow, 200 steps, JSON", iterations, [&] {
+        auto root = w3id_org::cwl::load_document_from_json(workflowJson);
+        doNotOptimize(*std::get<cwl::Workflow>(root).steps);
+    });
+
+    measure("store CommandLineTool, 500 parameters, YAML", iterations, [&] {
+        doNotOptimize(w3id_org::cwl::store_document_as_string(tool));
+    });
+
+    measure("store CommandLineTool, 500 parameters, JSON", iterations, [&] {
+        doNotOptimize(w3id_org::cwl::store_document_as_json(tool));
+    });
+
+    measure("store Workflow, 200 steps, YAML", iterations, [&] {
+        doNotOptimize(w3id_org::cwl::store_document_as_string(workflow));
+    });
+
+    measure("store Workflow, 200 steps, JSON", iterations, [&] {
+        doNotOptimize(w3id_org::cwl::store_document_as_json(workflow));
+    });
+
+    measure("convertToCWL, 500 parameters", iterations, [&] {
+        doNotOptimize(tdl::convertToCWL(info, {}));
+    });
+
+    measure("convertToCWLJson, 500 parameters", iterations, [&] {
+        doNotOptimize(tdl::convertToCWLJson(info));
+    });
+
+    return EXIT_SUCCESS;
+}
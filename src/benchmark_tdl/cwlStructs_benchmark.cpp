@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+
+#include <tdl/cwl_v1_2.h>
+
+#include "utils.h"
+
+namespace {
+
+namespace cwl = w3id_org::cwl::cwl;
+
+//!\brief a tool with `nbrOfInputs` file inputs, each with its own prefix
+auto makeTool(size_t nbrOfInputs) -> cwl::CommandLineTool {
+    auto tool = cwl::CommandLineTool{};
+    for (size_t i{0}; i < nbrOfInputs; ++i) {
+        auto name = "param" + std::to_string(i);
+
+        auto binding    = cwl::CommandLineBinding{};
+        *binding.prefix = "--" + name;
+
+        auto input          = cwl::CommandInputParameter{};
+        *input.id           = name;
+        *input.type         = cwl::CWLType::File;
+        *input.inputBinding = std::move(binding);
+        tool.inputs->push_back(std::move(input));
+    }
+    return tool;
+}
+
+} // namespace
+
+int main() {
+    constexpr size_t iterations = 100;
+
+    measure("build CommandLineTool, 1000 inputs", iterations, [&] {
+        doNotOptimize(*makeTool(1'000).inputs);
+    });
+
+    auto tool = makeTool(1'000);
+    measure("copy CommandLineTool, 1000 inputs", iterations, [&] {
+        auto copy = tool;
+        doNotOptimize(*copy.inputs);
+    });
+
+    return EXIT_SUCCESS;
+}
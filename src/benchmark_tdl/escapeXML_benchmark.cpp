@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+#include <vector>
+
+#include <tdl/escapeXML.h>
+
+#include "utils.h"
+
+namespace {
+
+//!\brief previous implementation, replaces all occurrences of a character with a string
+auto replace(std::string const & input, char const old_character, std::string const & new_string) {
+    auto out = std::string{};
+    out.reserve(input.size());
+
+    for (auto chr : input) {
+        if (chr == old_character) {
+            out.append(new_string);
+        } else {
+            out.push_back(chr);
+        }
+    }
+
+    return out;
+}
+
+//!\brief previous implementation, scanning the string once per special character
+auto escapeXMLReference(std::string str) {
+    str = replace(str, '&', "&amp;");
+    str = replace(str, '>', "&gt;");
+    str = replace(str, '"', "&quot;");
+    str = replace(str, '<', "&lt;");
+    str = replace(str, '\'', "&apos;");
+    str = replace(str, '\t', "&#x9;");
+    str = replace(str, '\n', "#br#");
+
+    return str;
+}
+
+} // namespace
+
+int main() {
+    // descriptions as they are typically found in OpenMS and SeqAn tools
+    auto const descriptions = std::vector<std::string>{
+        "",
+        "fasta",
+        "The k-mer size",
+        "Input file containing the reference sequences, one sequence per record",
+        "Mass tolerance in ppm or Da, depending on the unit that is chosen for the precursor mass",
+        "Number of threads to use for the computation of the alignments. A value of 0 uses all available cores",
+        "Minimum score required for a match, e.g. 'min_score' < 0.5 removes more than half of the \"hits\"",
+        "Output file\n"
+        "Note: the file is overwritten if it exists & no backup is created.\n"
+        "\tSupported formats are <fa> and <fq>"};
+
+    for (auto const & description : descriptions) {
+        if (tdl::detail::escapeXML(description) != escapeXMLReference(description)) {
+            std::cerr << "escapeXML differs from the reference implementation for: " << description << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+
+    constexpr size_t iterations = 200'000;
+
+    measure("escapeXML (reference)", iterations, [&] {
+        for (auto const & description : descriptions) {
+            doNotOptimize(escapeXMLReference(description));
+        }
+    });
+
+    measure("escapeXML", iterations, [&] {
+        for (auto const & description : descriptions) {
+            doNotOptimize(tdl::detail::escapeXML(description));
+        }
+    });
+
+    measure("writeEscapedXML (into buffer)", iterations, [&] {
+        auto buffer = std::string{};
+        auto sink   = [&](std::string_view str) {
+            buffer.append(str);
+        };
+        for (auto const & description : descriptions) {
+            tdl::detail::writeEscapedXML(sink, description);
+        }
+        doNotOptimize(buffer);
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+
+#include "utils.h"
+
+int main() {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "large_tool";
+    doc.metaInfo.executableName = "large_tool";
+    for (size_t s{0}; s < 100; ++s) {
+        auto children = tdl::Node::Children{};
+        for (size_t i{0}; i < 50; ++i) {
+            auto name = "section" + std::to_string(s) + "_parameter" + std::to_string(i);
+            children.push_back({name, "a parameter with a description", {"advanced"}, tdl::IntValue{1, 0, 100}});
+            doc.cliMapping.push_back({"--" + name, name});
+        }
+        doc.params.push_back({"section" + std::to_string(s), "a section", {}, std::move(children)});
+    }
+
+    constexpr size_t iterations = 20;
+
+    // the fingerprint decides whether the conversions can be skipped
+    measure("fingerprint, 5k parameters", iterations, [&] {
+        doNotOptimize(tdl::fingerprint(doc).toString());
+    });
+
+    measure("convertToCTD, 5k parameters", iterations, [&] {
+        doNotOptimize(tdl::convertToCTD(doc));
+    });
+
+    measure("convertToCWL, 5k parameters", iterations, [&] {
+        doNotOptimize(tdl::convertToCWL(doc, {}));
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+namespace {
+
+//!\brief a tool with a typical number of parameters
+auto makeToolInfo(size_t index) -> tdl::ToolInfo {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "tool" + std::to_string(index);
+    doc.metaInfo.version        = "1.0.0";
+    doc.metaInfo.description    = "Tool number " + std::to_string(index) + " of a large tool suite.";
+    doc.metaInfo.executableName = doc.metaInfo.name;
+
+    for (size_t i{0}; i < 50; ++i) {
+        auto name = "param" + std::to_string(i);
+        switch (i % 4) {
+        case 0: doc.params.push_back({name, "an integer", {"advanced"}, tdl::IntValue{5, 0, 10}}); break;
+        case 1: doc.params.push_back({name, "a double", {}, tdl::DoubleValue{0.25, 0., 1.}}); break;
+        case 2: doc.params.push_back({name, "an input file", {"input file"}, tdl::StringValue{"in.fa", {{"fa"}}}}); break;
+        default: doc.params.push_back({name, "a list of values", {}, tdl::DoubleValueList{{1.5, 2.5, 3.5}}}); break;
+        }
+        doc.cliMapping.push_back({"--" + name, name});
+    }
+    return doc;
+}
+
+//!\brief reads the file into a string before parsing it
+auto loadCTDReference(std::filesystem::path const & path) -> tdl::ToolInfo {
+    auto file = std::ifstream{path, std::ios::binary};
+    auto ss   = std::stringstream{};
+    ss << file.rdbuf();
+    return tdl::parseCTD(ss.str());
+}
+
+} // namespace
+
+int main() {
+    auto directory = std::filesystem::temp_directory_path() / "tdl_benchmark_load_ctd";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    constexpr size_t nbrOfFiles = 1'000;
+    for (size_t i{0}; i < nbrOfFiles; ++i) {
+        auto file = std::ofstream{directory / ("tool" + std::to_string(i) + ".ctd"), std::ios::binary};
+        file << tdl::convertToCTD(makeToolInfo(i));
+    }
+
+    constexpr size_t iterations = 10;
+
+    measure("ifstream + parseCTD (1000 files)", iterations, [&] {
+        for (auto const & entry : std::filesystem::directory_iterator{directory}) {
+            doNotOptimize(loadCTDReference(entry.path()).params);
+        }
+    });
+
+    measure("loadCTDDirectory (1000 files)", iterations, [&] {
+        doNotOptimize(tdl::loadCTDDirectory(directory));
+    });
+
+    std::filesystem::remove_all(directory);
+    return EXIT_SUCCESS;
+}
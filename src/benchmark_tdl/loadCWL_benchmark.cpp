@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+
+#include <tdl/cwl_v1_2.h>
+#include <tdl/cwl_v1_2_stream.h>
+
+#include "utils.h"
+
+namespace {
+
+namespace cwl = w3id_org::cwl::cwl;
+
+//!\brief a packed document, `nbrOfTools` tools and a workflow in one `$graph` list
+auto makePacked(std::string const & tool, std::string const & workflow, size_t nbrOfTools) -> std::string {
+    auto indented = [](std::string const & text) {
+        auto result = std::string{"  - "};
+        for (size_t i{0}; i < text.size(); ++i) {
+            result += text[i];
+            if (text[i] == '\n' && i + 1 < text.size()) {
+                result += "    ";
+            }
+        }
+        if (result.back() != '\n') {
+            result += '\n';
+        }
+        return result;
+    };
+    auto text = std::string{"cwlVersion: v1.2\n$graph:\n"};
+    for (size_t i{0}; i < nbrOfTools; ++i) {
+        text += indented(tool);
+    }
+    return text + indented(workflow);
+}
+
+} // namespace
+
+int main() {
+    auto tool     = tdl::convertToCWL(makeMixedToolInfo(500), {});
+    auto workflow = makeWorkflow(200);
+    auto packed   = makePacked(tdl::convertToCWL(makeMixedToolInfo(100), {}), workflow, 50);
+
+    constexpr size_t iterations = 10;
+
+    measure("load CommandLineTool, 500 parameters", iterations, [&] {
+        auto root = w3id_org::cwl::load_document_from_string(tool);
+        doNotOptimize(*std::get<cwl::CommandLineTool>(root).inputs);
+    });
+
+    measure("load Workflow, 200 steps", iterations, [&] {
+        auto root = w3id_org::cwl::load_document_from_string(workflow);
+        doNotOptimize(*std::get<cwl::Workflow>(root).steps);
+    });
+
+    measure("load CommandLineTool, 500 parameters, event based", iterations, [&] {
+        auto documents = w3id_org::cwl::load_documents_from_string(tool);
+        doNotOptimize(*std::get<cwl::CommandLineTool>(documents[0]).inputs);
+    });
+
+    measure("load Workflow, 200 steps, event based", iterations, [&] {
+        auto documents = w3id_org::cwl::load_documents_from_string(workflow);
+        doNotOptimize(*std::get<cwl::Workflow>(documents[0]).steps);
+    });
+
+    measure("load $graph, 50 tools and a workflow, event based", iterations, [&] {
+        auto documents = w3id_org::cwl::load_documents_from_string(packed);
+        doNotOptimize(documents);
+    });
+
+    return EXIT_SUCCESS;
+}
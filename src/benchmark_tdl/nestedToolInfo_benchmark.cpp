@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "utils.h"
+
+int main() {
+    // convertToCWL descends 5 levels (generateCWL, collectCWL), a deeper tree would only be converted in parts
+    auto doc = makeNestedToolInfo(/*.depth=*/5, /*.fanOut=*/40);
+
+    constexpr size_t iterations = 200;
+
+    measure("convertToCWL, reference (depth 5)", iterations, [&] {
+        doNotOptimize(tdl::detail::convertToCWLReference(doc, {}));
+    });
+
+    measure("convertToCWL, direct writer (depth 5)", iterations, [&] {
+        doNotOptimize(tdl::convertToCWL(doc, {}));
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <new>
+#include <string>
+
+#include "utils.h"
+
+#if TDL_HAS_PMR
+
+namespace {
+
+//!\brief a tool with many sections, each holding a few parameters
+auto makeToolInfo(size_t sections, size_t paramsPerSection) -> tdl::ToolInfo {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "large_tool";
+    doc.metaInfo.executableName = "large_tool";
+    for (size_t s{0}; s < sections; ++s) {
+        auto children = tdl::Node::Children{};
+        for (size_t i{0}; i < paramsPerSection; ++i) {
+            auto name = "section" + std::to_string(s) + "_parameter" + std::to_string(i);
+            children.push_back({name, "a parameter with a description", {"advanced", "custom tag"},
+                                tdl::StringValueList{{"first value", "second value"}}});
+            doc.cliMapping.push_back({"--" + name, name});
+        }
+        doc.params.push_back({"section" + std::to_string(s), "a section", {}, std::move(children)});
+    }
+    return doc;
+}
+
+} // namespace
+
+int main() {
+    auto doc = makeToolInfo(/*.sections=*/1'000, /*.paramsPerSection=*/50);
+
+    constexpr size_t iterations = 20;
+
+    measure("copy and free, std::allocator", iterations, [&] {
+        auto copy = doc;
+        doNotOptimize(copy.params);
+    });
+
+    measure("copy and free, monotonic arena", iterations, [&] {
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        auto copy  = tdl::pmr::ToolInfo{doc, &arena};
+        doNotOptimize(copy.params);
+    });
+
+    measure("copy, arena released at once", iterations, [&] {
+        // the tool itself is placed in the arena as well, no destructor has to run
+        auto arena  = std::pmr::monotonic_buffer_resource{};
+        auto memory = arena.allocate(sizeof(tdl::pmr::ToolInfo), alignof(tdl::pmr::ToolInfo));
+        auto copy   = new (memory) tdl::pmr::ToolInfo{doc, &arena};
+        doNotOptimize(copy->params);
+    });
+
+    auto pmrArena = std::pmr::monotonic_buffer_resource{};
+    auto pmrDoc   = tdl::pmr::ToolInfo{doc, &pmrArena};
+
+    measure("convertToCTD, std::allocator", iterations, [&] {
+        doNotOptimize(tdl::convertToCTD(doc));
+    });
+
+    measure("convertToCTD, monotonic arena", iterations, [&] {
+        doNotOptimize(tdl::convertToCTD(pmrDoc));
+    });
+
+    measure("convertToCWL, std::allocator", iterations, [&] {
+        doNotOptimize(tdl::convertToCWL(doc, {}));
+    });
+
+    measure("convertToCWL, monotonic arena", iterations, [&] {
+        doNotOptimize(tdl::convertToCWL(pmrDoc, {}));
+    });
+
+    return EXIT_SUCCESS;
+}
+
+#else
+
+int main() {
+    std::cout << "std::pmr is not available\n";
+    return EXIT_SUCCESS;
+}
+
+#endif
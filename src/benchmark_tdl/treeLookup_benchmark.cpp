@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils.h"
+
+namespace {
+
+//!\brief all nodes carrying `tag`, found by a recursive walk over the tree
+void collectTagged(tdl::Node::Children const & children, tdl::Tag tag, std::vector<tdl::Node const *> & result) {
+    for (auto const & child : children) {
+        if (child.tags.count(tag)) {
+            result.push_back(&child);
+        }
+        if (auto grandChildren = std::get_if<tdl::Node::Children>(&child.value)) {
+            collectTagged(*grandChildren, tag, result);
+        }
+    }
+}
+
+//!\brief the node with the given path, found by a linear search on each level
+auto findLinear(tdl::Node::Children & params, std::string_view path) -> tdl::Node * {
+    auto * children = &params;
+    while (true) {
+        auto name = path.substr(0, path.find(':'));
+        auto iter = std::find_if(children->begin(), children->end(), [&](auto const & node) {
+            return node.name == name;
+        });
+        if (iter == children->end()) {
+            return nullptr;
+        }
+        if (name.size() == path.size()) {
+            return &*iter;
+        }
+        path.remove_prefix(name.size() + 1);
+        children = std::get_if<tdl::Node::Children>(&iter->value);
+        if (!children) {
+            return nullptr;
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    auto doc = makeNestedToolInfo(/*.depth=*/10, /*.fanOut=*/20);
+
+    constexpr size_t iterations = 200;
+
+    measure("advanced parameters, recursive walk", iterations, [&] {
+        auto result = std::vector<tdl::Node const *>{};
+        collectTagged(doc.params, tdl::Tag::advanced, result);
+        doNotOptimize(result);
+    });
+
+    auto flat = tdl::FlatTree{doc.params};
+    measure("advanced parameters, FlatTree", iterations, [&] {
+        doNotOptimize(flat.withTags({tdl::Tag::advanced}));
+    });
+
+    auto paths = std::vector<std::string>{};
+    for (size_t i{0}; i < flat.size(); ++i) {
+        paths.push_back(flat.path(i));
+    }
+
+    measure("lookup all paths, linear search", iterations, [&] {
+        auto found = std::vector<tdl::Node *>{};
+        for (auto const & path : paths) {
+            found.push_back(findLinear(doc.params, path));
+        }
+        doNotOptimize(found);
+    });
+
+    auto index = tdl::PathIndex{doc.params};
+    measure("lookup all paths, PathIndex", iterations, [&] {
+        auto found = std::vector<tdl::Node *>{};
+        for (auto const & path : paths) {
+            found.push_back(index.find(path));
+        }
+        doNotOptimize(found);
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <tdl/tdl.h>
+
+//!\brief global sink, the sizes of all benchmark results are accumulated in it
+inline size_t volatile benchmarkSink{};
+
+//!\brief prevents the compiler from optimizing away the computation of `value`
+template <typename T>
+void doNotOptimize(T const & value) {
+    benchmarkSink = benchmarkSink + value.size();
+}
+
+//!\brief runs `cb` `iterations` times and prints the average duration of a single call
+template <typename CB>
+void measure(std::string_view name, size_t iterations, CB const & cb) {
+    cb(); // warm up
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i{0}; i < iterations; ++i) {
+        cb();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    auto ns = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(14) << std::fixed
+              << std::setprecision(1) << ns << " ns/call\n";
+}
+
+//!\brief a large tool of file, output, string list and double list parameters, each with its own option
+inline auto makeMixedToolInfo(size_t nbrOfParams) -> tdl::ToolInfo {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "large_tool";
+    doc.metaInfo.executableName = "large_tool";
+    for (size_t i{0}; i < nbrOfParams; ++i) {
+        auto name = "param" + std::to_string(i);
+        switch (i % 4) {
+        case 0: doc.params.push_back({name, "an input file", {"file", "required"}, tdl::StringValue{}}); break;
+        case 1: doc.params.push_back({name, "an output file", {"output", "file"}, tdl::StringValue{}}); break;
+        case 2: doc.params.push_back({name, "a list of names", {}, tdl::StringValueList{{"a", "b"}}}); break;
+        default: doc.params.push_back({name, "a list of values", {}, tdl::DoubleValueList{{1.5, 2.5}}}); break;
+        }
+        doc.cliMapping.push_back({"--" + name, name});
+    }
+    return doc;
+}
+
+/*!\brief a chain of nested sections
+ *
+ * Each section holds `fanOut` string list parameters tagged "advanced" and the next section, the innermost
+ * section is at `depth`.
+ */
+inline auto makeNestedToolInfo(size_t depth, size_t fanOut) -> tdl::ToolInfo {
+    auto section = tdl::Node::Children{};
+    for (size_t level{depth}; level > 0; --level) {
+        auto children = tdl::Node::Children{};
+        for (size_t i{0}; i < fanOut; ++i) {
+            auto name = "param" + std::to_string(level) + "_" + std::to_string(i);
+            children.push_back({name, "a parameter", {"advanced"}, tdl::StringValueList{{"a", "b", "c"}}});
+        }
+        if (!section.empty()) {
+            children.push_back({"section" + std::to_string(level + 1), "a section", {}, std::move(section)});
+        }
+        section = std::move(children);
+    }
+
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "nested";
+    doc.metaInfo.executableName = "nested";
+    doc.params                  = std::move(section);
+    return doc;
+}
+
+//!\brief a CWL workflow chaining `nbrOfSteps` steps, each with requirements and hints
+inline auto makeWorkflow(size_t nbrOfSteps) -> std::string {
+    auto text = std::string{"cwlVersion: v1.2\nclass: Workflow\n"
+                            "requirements:\n"
+                            "  - class: ScatterFeatureRequirement\n"
+                            "  - class: StepInputExpressionRequirement\n"
+                            "inputs:\n"
+                            "  input: File\n"
+                            "  threads: int?\n"
+                            "outputs:\n"
+                            "  result:\n"
+                            "    type: File\n"
+                            "    outputSource: step"
+                            + std::to_string(nbrOfSteps - 1) + "/out\n"
+                            "steps:\n"};
+    for (size_t i{0}; i < nbrOfSteps; ++i) {
+        auto name = "step" + std::to_string(i);
+        text += "  " + name + ":\n";
+        text += "    run: tool.cwl\n";
+        text += "    in:\n";
+        text += "      file: " + (i == 0 ? std::string{"input"} : "step" + std::to_string(i - 1) + "/out") + "\n";
+        text += "      threads: threads\n";
+        text += "    out: [out]\n";
+        text += "    requirements:\n";
+        text += "      - class: ResourceRequirement\n";
+        text += "        coresMin: 2\n";
+        text += "        ramMin: 1024\n";
+        text += "      - class: DockerRequirement\n";
+        text += "        dockerPull: example/tool:1.0\n";
+        text += "    hints:\n";
+        text += "      - class: ToolTimeLimit\n";
+        text += "        timelimit: 3600\n";
+    }
+    return text;
+}
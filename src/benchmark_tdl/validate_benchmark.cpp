@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+namespace {
+
+//!\brief state() only returns a state, the size of its result is the validity
+struct StateResult {
+    bool valid;
+
+    auto size() const -> size_t {
+        return valid;
+    }
+};
+
+} // namespace
+
+int main() {
+    constexpr size_t iterations = 100;
+
+    auto ints = tdl::IntValueList{{}, 0, 1'000'000};
+    for (int i{0}; i < 1'000'000; ++i) {
+        ints.value.push_back(i);
+    }
+    auto doubles = tdl::DoubleValueList{{}, 0.0, 1.0};
+    for (size_t i{0}; i < 1'000'000; ++i) {
+        doubles.value.push_back(static_cast<double>(i) / 1'000'000.0);
+    }
+
+    auto validValues = std::vector<std::string>{};
+    for (size_t i{0}; i < 100; ++i) {
+        validValues.push_back("value" + std::to_string(i));
+    }
+    auto strings = tdl::StringValueList{{}, validValues};
+    for (size_t i{0}; i < 10'000; ++i) {
+        strings.value.push_back(validValues[(i * 7) % validValues.size()]);
+    }
+
+    auto intNode    = tdl::Node{"ints", "", {}, ints};
+    auto doubleNode = tdl::Node{"doubles", "", {}, doubles};
+    auto stringNode = tdl::Node{"strings", "", {}, strings};
+
+    measure("state, 1M ints", iterations, [&] {
+        doNotOptimize(StateResult{ints.state() == tdl::IntValueList::State::Ok});
+    });
+
+    measure("validateValue, 1M ints", iterations, [&] {
+        doNotOptimize(tdl::validateValue(intNode));
+    });
+
+    measure("state, 1M doubles", iterations, [&] {
+        doNotOptimize(StateResult{doubles.state() == tdl::DoubleValueList::State::Ok});
+    });
+
+    measure("validateValue, 1M doubles", iterations, [&] {
+        doNotOptimize(tdl::validateValue(doubleNode));
+    });
+
+    measure("state, 10k strings of 100 valid", iterations, [&] {
+        doNotOptimize(StateResult{strings.state() == tdl::StringValueList::State::Valid});
+    });
+
+    measure("validateValue, 10k strings of 100 valid", iterations, [&] {
+        doNotOptimize(tdl::validateValue(stringNode));
+    });
+
+    auto doc = tdl::ToolInfo{};
+    for (size_t s{0}; s < 1'000; ++s) {
+        auto children = tdl::Node::Children{};
+        for (size_t i{0}; i < 50; ++i) {
+            auto name = "section" + std::to_string(s) + "_parameter" + std::to_string(i);
+            children.push_back({name, "", {}, tdl::IntValue{static_cast<int>(i), 0, 100}});
+            doc.cliMapping.push_back({"--" + name, name});
+        }
+        doc.params.push_back({"section" + std::to_string(s), "a section", {"basecommand"}, std::move(children)});
+    }
+
+    measure("validate, 50k parameters", 20, [&] {
+        doNotOptimize(tdl::validate(doc));
+    });
+
+    return EXIT_SUCCESS;
+}
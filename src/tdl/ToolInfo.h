@@ -5,11 +5,18 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <numeric>
 #include <optional>
-#include <set>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -55,26 +62,28 @@ struct TValue {
             if (maxLimit && *maxLimit < value) {
                 return State::ValueTooHigh;
             }
+            return State::Ok;
         };
 
-        if constexpr (is_vector_v<T>) {
+        if constexpr (is_vector_v<ListType>) {
             for (auto const & element : value) {
-                check_value(element);
+                if (auto state = check_value(element); state != State::Ok) {
+                    return state;
+                }
             }
+            return State::Ok;
         } else {
-            check_value(value);
+            return check_value(value);
         }
-
-        return State::Ok;
     }
 };
 
 /*!\brief Stores a string with optional list of valid strings.
  */
-template <typename T, typename ListType = T>
+template <typename T, typename ListType = T, typename ValidList = std::vector<T>>
 struct TStringValue {
-    ListType                      value{};
-    std::optional<std::vector<T>> validValues{};
+    ListType                 value{};
+    std::optional<ValidList> validValues{};
 
     enum class State {
         Valid,
@@ -91,20 +100,19 @@ struct TStringValue {
                 return value == pattern;
             });
 
-            if (!is_valid) {
-                return State::Invalid;
-            }
+            return is_valid ? State::Valid : State::Invalid;
         };
 
-        if constexpr (is_vector_v<T>) {
+        if constexpr (is_vector_v<ListType>) {
             for (auto const & element : value) {
-                checkSingleValue(element);
+                if (checkSingleValue(element) == State::Invalid) {
+                    return State::Invalid;
+                }
             }
+            return State::Valid;
         } else {
-            checkSingleValue(value);
+            return checkSingleValue(value);
         }
-
-        return State::Valid;
     }
 };
 
@@ -119,6 +127,267 @@ using IntValueList    = detail::TValue<int, std::vector<int>>;
 using DoubleValueList = detail::TValue<double, std::vector<double>>;
 using StringValueList = detail::TStringValue<std::string, std::vector<std::string>>;
 
+//!\brief tags with a special meaning for the converters, see Tags::names for their spelling
+enum class Tag : uint8_t {
+    advanced,
+    basecommand,
+    default_as_hint,
+    directory,
+    file,
+    input_file,
+    no_default,
+    output,
+    output_file,
+    output_prefix,
+    prefixed,
+    required,
+};
+
+/*!\brief set of tags of a Node
+ *
+ * Can be used like a std::set<std::string>. The tags listed in Tag are stored as bits, so looking
+ * them up does not compare strings and a Node carrying only such tags does not allocate.
+ * All other tags are kept in a sorted vector. Iterating yields all tags in sorted order, as
+ * std::string_view instead of std::string const&, there is no string to refer to for a bit.
+ * The vector uses `Allocator`, see pmr::Tags for a variant living in a memory resource.
+ */
+template <typename String, typename Allocator>
+class BasicTags {
+public:
+    //!\brief spelling of the tags listed in Tag, sorted
+    static constexpr auto names = std::array<std::string_view, 12>{
+        "advanced",   "basecommand", "default_as_hint", "directory",     "file",     "input file",
+        "no_default", "output",      "output file",     "output prefix", "prefixed", "required"};
+
+    //!\brief iterates over all tags in sorted order
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::string_view;
+
+        const_iterator() = default;
+
+        auto operator*() const noexcept -> std::string_view {
+            return fromBits() ? names[bit] : std::string_view{tags->others[other]};
+        }
+
+        auto operator++() noexcept -> const_iterator & {
+            if (fromBits()) {
+                bit = tags->nextBit(bit + 1);
+            } else {
+                ++other;
+            }
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> const_iterator {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend auto operator==(const_iterator const & lhs, const_iterator const & rhs) noexcept -> bool {
+            return lhs.bit == rhs.bit && lhs.other == rhs.other;
+        }
+
+        friend auto operator!=(const_iterator const & lhs, const_iterator const & rhs) noexcept -> bool {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class BasicTags;
+
+        BasicTags const * tags{};
+        size_t       bit{};   //!< position of the next set bit, names.size() if none is left
+        size_t       other{}; //!< position of the next entry in others
+
+        const_iterator(BasicTags const * tags, size_t bit, size_t other) noexcept
+            : tags{tags}, bit{bit}, other{other} {}
+
+        auto fromBits() const noexcept -> bool {
+            return bit < names.size() && (other == tags->others.size() || names[bit] < tags->others[other]);
+        }
+    };
+
+    using iterator       = const_iterator;
+    using value_type     = std::string_view;
+    using size_type      = size_t;
+    using allocator_type = Allocator;
+
+    BasicTags() = default;
+
+    explicit BasicTags(Allocator const & alloc) : others(alloc) {}
+
+    BasicTags(std::initializer_list<std::string_view> tags, Allocator const & alloc = Allocator{}) : others(alloc) {
+        for (auto tag : tags) {
+            insert(tag);
+        }
+    }
+
+    //!\brief copies tags of another BasicTags type, e.g. of Tags into pmr::Tags
+    template <typename OtherString, typename OtherAllocator>
+    explicit BasicTags(BasicTags<OtherString, OtherAllocator> const & other, Allocator const & alloc = Allocator{})
+        : others(alloc) {
+        for (auto tag : other) {
+            insert(tag);
+        }
+    }
+
+    BasicTags(BasicTags const &)     = default;
+    BasicTags(BasicTags &&) noexcept = default;
+    BasicTags(BasicTags const & other, Allocator const & alloc) : bits{other.bits}, others(other.others, alloc) {}
+    BasicTags(BasicTags && other, Allocator const & alloc) : bits{other.bits}, others(std::move(other.others), alloc) {}
+
+    auto operator=(BasicTags const &) -> BasicTags & = default;
+    auto operator=(BasicTags &&) -> BasicTags &      = default;
+
+    auto get_allocator() const noexcept -> allocator_type {
+        return others.get_allocator();
+    }
+
+    //!\brief the Tag with the given spelling, std::nullopt if it is not one of them
+    static constexpr auto knownTag(std::string_view tag) noexcept -> std::optional<Tag> {
+        for (size_t i{0}; i < names.size(); ++i) {
+            if (names[i] == tag) {
+                return static_cast<Tag>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    auto count(Tag tag) const noexcept -> size_t {
+        return (bits >> static_cast<uint8_t>(tag)) & 1u;
+    }
+
+    auto count(std::string_view tag) const noexcept -> size_t {
+        if (auto known = knownTag(tag)) {
+            return count(*known);
+        }
+        return std::binary_search(others.begin(), others.end(), tag, std::less<>{}) ? 1 : 0;
+    }
+
+    //!\brief iterator to the tag, end() if it is not present
+    auto find(Tag tag) const noexcept -> const_iterator {
+        return count(tag) != 0 ? atBit(static_cast<size_t>(tag)) : end();
+    }
+
+    auto find(std::string_view tag) const noexcept -> const_iterator {
+        if (auto known = knownTag(tag)) {
+            return find(*known);
+        }
+        auto iter = std::lower_bound(others.begin(), others.end(), tag, std::less<>{});
+        if (iter == others.end() || *iter != tag) {
+            return end();
+        }
+        return atOther(static_cast<size_t>(iter - others.begin()));
+    }
+
+    //!\brief adds a tag, like std::set::insert returns an iterator to it and false if it was already present
+    auto insert(Tag tag) noexcept -> std::pair<iterator, bool> {
+        auto inserted = count(tag) == 0;
+        bits |= static_cast<uint16_t>(1u << static_cast<uint8_t>(tag));
+        return {atBit(static_cast<size_t>(tag)), inserted};
+    }
+
+    auto insert(std::string_view tag) -> std::pair<iterator, bool> {
+        if (auto known = knownTag(tag)) {
+            return insert(*known);
+        }
+        auto iter     = std::lower_bound(others.begin(), others.end(), tag, std::less<>{});
+        auto inserted = iter == others.end() || *iter != tag;
+        if (inserted) {
+            iter = others.emplace(iter, tag);
+        }
+        return {atOther(static_cast<size_t>(iter - others.begin())), inserted};
+    }
+
+    //!\brief removes a tag, returns the number of removed tags (0 or 1)
+    auto erase(Tag tag) noexcept -> size_t {
+        auto erased = count(tag);
+        bits &= static_cast<uint16_t>(~(1u << static_cast<uint8_t>(tag)));
+        return erased;
+    }
+
+    auto erase(std::string_view tag) -> size_t {
+        if (auto known = knownTag(tag)) {
+            return erase(*known);
+        }
+        auto iter = std::lower_bound(others.begin(), others.end(), tag, std::less<>{});
+        if (iter == others.end() || *iter != tag) {
+            return 0;
+        }
+        others.erase(iter);
+        return 1;
+    }
+
+    auto size() const noexcept -> size_t {
+        auto knownTags = size_t{0};
+        for (auto b = bits; b != 0; b &= static_cast<uint16_t>(b - 1)) {
+            ++knownTags;
+        }
+        return knownTags + others.size();
+    }
+
+    auto empty() const noexcept -> bool {
+        return bits == 0 && others.empty();
+    }
+
+    void clear() noexcept {
+        bits = 0;
+        others.clear();
+    }
+
+    //!\brief bit i is set if the tag `Tag(i)` is present, tags not listed in Tag are not included
+    auto knownTags() const noexcept -> uint16_t {
+        return bits;
+    }
+
+    auto begin() const noexcept -> const_iterator {
+        return {this, nextBit(0), 0};
+    }
+
+    auto end() const noexcept -> const_iterator {
+        return {this, names.size(), others.size()};
+    }
+
+    friend auto operator==(BasicTags const & lhs, BasicTags const & rhs) noexcept -> bool {
+        return lhs.bits == rhs.bits && lhs.others == rhs.others;
+    }
+
+    friend auto operator!=(BasicTags const & lhs, BasicTags const & rhs) noexcept -> bool {
+        return !(lhs == rhs);
+    }
+
+private:
+    uint16_t                       bits{};   //!< bit i is set if the tag `Tag(i)` is present
+    std::vector<String, Allocator> others{}; //!< sorted tags that are not listed in Tag
+
+    //!\brief position of the first set bit starting at `pos`, names.size() if there is none
+    auto nextBit(size_t pos) const noexcept -> size_t {
+        while (pos < names.size() && ((bits >> pos) & 1u) == 0) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    //!\brief iterator to the known tag `Tag(bit)`, the entries of others sorted before it are skipped
+    auto atBit(size_t bit) const noexcept -> const_iterator {
+        auto iter = std::lower_bound(others.begin(), others.end(), names[bit], std::less<>{});
+        return {this, bit, static_cast<size_t>(iter - others.begin())};
+    }
+
+    //!\brief iterator to `others[other]`, the known tags sorted before it are skipped
+    auto atOther(size_t other) const noexcept -> const_iterator {
+        auto name = std::upper_bound(names.begin(), names.end(), std::string_view{others[other]});
+        return {this, nextBit(static_cast<size_t>(name - names.begin())), other};
+    }
+};
+
+using Tags = BasicTags<std::string, std::allocator<std::string>>;
+
 /*!\brief represents a parameter tree or a subtree of the parameter tree.
  *
  * This represents values that are structured in a tree and strongly typed.
@@ -134,10 +403,10 @@ struct Node {
                                StringValueList,
                                Children>; // not a value, but a node with children
 
-    std::string           name{};            //!< Name of the entry.
-    std::string           description{};     //!< Entry description.
-    std::set<std::string> tags{};            //!< List of tags, e.g.: advanced parameter tag.
-    Value                 value{Children{}}; //!< Current value of this entry
+    std::string name{};            //!< Name of the entry.
+    std::string description{};     //!< Entry description.
+    Tags        tags{};            //!< List of tags, e.g.: advanced parameter tag.
+    Value       value{Children{}}; //!< Current value of this entry
 };
 
 //! A pair of mapping from tree parameter names to cli names
@@ -170,4 +439,21 @@ struct ToolInfo {
     std::vector<CLIMapping> cliMapping{};
 };
 
+namespace detail {
+
+/*!\brief the value types of a node type
+ *
+ * Node and pmr::Node list the alternatives of their Value in the same order,
+ * this allows code that handles both node types.
+ */
+template <typename NodeT>
+struct NodeValueTypes {
+    using StringValue     = std::variant_alternative_t<3, typename NodeT::Value>;
+    using IntValueList    = std::variant_alternative_t<4, typename NodeT::Value>;
+    using DoubleValueList = std::variant_alternative_t<5, typename NodeT::Value>;
+    using StringValueList = std::variant_alternative_t<6, typename NodeT::Value>;
+};
+
+} // namespace detail
+
 } // namespace tdl
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "cliMappingIndex.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace tdl::detail {
+
+void CLIMappingIndex::add(std::string_view referenceName, std::string_view optionIdentifier) {
+    if (!index.try_emplace(referenceName, optionIdentifier).second) {
+        throw std::runtime_error{"cliMapping contains the referenceName '" + std::string{referenceName}
+                                 + "' more than once"};
+    }
+}
+
+} // namespace tdl::detail
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace tdl::detail {
+
+/*!\brief lookup of the optionIdentifier of a parameter by its referenceName
+ *
+ * Built once per conversion, so looking up all parameters takes linear time.
+ * The index refers to the strings of the given mappings, they must outlive it and not be modified.
+ */
+class CLIMappingIndex {
+public:
+    /*!\brief indexes a list of CLIMapping (or pmr::CLIMapping)
+     * \throws std::runtime_error if two mappings have the same referenceName
+     */
+    template <typename Mappings>
+    explicit CLIMappingIndex(Mappings const & mappings) {
+        index.reserve(mappings.size());
+        for (auto const & mapping : mappings) {
+            add(mapping.referenceName, mapping.optionIdentifier);
+        }
+    }
+
+    //!\brief optionIdentifier of the mapping with the given referenceName, std::nullopt if none exists
+    auto find(std::string_view referenceName) const noexcept -> std::optional<std::string_view> {
+        auto iter = index.find(referenceName);
+        if (iter == index.end()) {
+            return std::nullopt;
+        }
+        return iter->second;
+    }
+
+private:
+    std::unordered_map<std::string_view, std::string_view> index{};
+
+    void add(std::string_view referenceName, std::string_view optionIdentifier);
+};
+
+} // namespace tdl::detail
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "conversionCache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <system_error>
+
+#include "convertToCTD.h"
+#include "fingerprint.h"
+
+#ifndef TDL_VERSION
+#    error "TDL_VERSION must be defined, it is part of the cache keys (see cmake/version.cmake)"
+#endif
+
+namespace tdl {
+
+namespace {
+
+constexpr auto indexFileName = std::string_view{"index"};
+
+auto entryPath(std::filesystem::path const & root, std::string_view key, std::string_view format)
+    -> std::filesystem::path {
+    auto name = std::string{key};
+    name += '.';
+    name += format;
+    return root / name;
+}
+
+//!\brief a name that no other process or thread uses at the same time
+auto temporaryPath(std::filesystem::path const & root, std::string_view key) -> std::filesystem::path {
+    thread_local auto random = std::mt19937_64{std::random_device{}()};
+
+    auto name = std::string{"."};
+    name += key;
+    name += '.';
+    name += std::to_string(random());
+    name += ".tmp";
+    return root / name;
+}
+
+//!\brief tabs and line breaks would break the index, they are replaced by spaces
+auto indexField(std::string_view value) -> std::string {
+    auto field = std::string{value};
+    std::replace_if(field.begin(), field.end(), [](char c) { return c == '\t' || c == '\n' || c == '\r'; }, ' ');
+    return field;
+}
+
+} // namespace
+
+ConversionCache::ConversionCache(std::filesystem::path directory) : root{std::move(directory)} {
+    std::filesystem::create_directories(root);
+}
+
+auto ConversionCache::key(ToolInfo const & doc, std::string_view format, std::string_view optionsId) -> std::string {
+    // fields separated by '\0', the options id comes last and may contain anything
+    auto data = fingerprint(doc).toString();
+    for (auto field : {std::string_view{TDL_VERSION}, format, optionsId}) {
+        data += '\0';
+        data += field;
+    }
+    return detail::fingerprintBytes(data).toString();
+}
+
+auto ConversionCache::find(std::string_view key, std::string_view format) const -> std::optional<std::string> {
+    auto file = std::ifstream{entryPath(root, key, format), std::ios::binary | std::ios::ate};
+    if (!file) {
+        return std::nullopt;
+    }
+    // entries are complete when they become visible, so the size is known upfront
+    auto content = std::string(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!file.read(content.data(), static_cast<std::streamsize>(content.size()))) {
+        return std::nullopt;
+    }
+    return content;
+}
+
+void ConversionCache::store(std::string_view key,
+                            std::string_view format,
+                            ToolInfo const & doc,
+                            std::string_view content) {
+    auto temporary = temporaryPath(root, key);
+    {
+        auto file = std::ofstream{temporary, std::ios::binary};
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        file.close();
+        if (!file) {
+            auto error = std::error_code{};
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+
+    // the rename replaces the entry atomically, readers never see a partially written file
+    auto error = std::error_code{};
+    std::filesystem::rename(temporary, entryPath(root, key, format), error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+        return;
+    }
+
+    // the short line is written at once when the stream is closed, appends of several processes do not interleave
+    auto line = std::string{key};
+    for (auto field : {format, std::string_view{doc.metaInfo.name}, std::string_view{doc.metaInfo.version}}) {
+        line += '\t';
+        line += indexField(field);
+    }
+    line += '\n';
+    auto index = std::ofstream{root / indexFileName, std::ios::binary | std::ios::app};
+    index.write(line.data(), static_cast<std::streamsize>(line.size()));
+}
+
+auto ConversionCache::entries() const -> std::vector<ConversionCacheEntry> {
+    auto result = std::vector<ConversionCacheEntry>{};
+    auto index  = std::ifstream{root / indexFileName, std::ios::binary};
+    for (auto line = std::string{}; std::getline(index, line);) {
+        auto fields = std::istringstream{line};
+        auto entry  = ConversionCacheEntry{};
+        if (std::getline(fields, entry.key, '\t') && std::getline(fields, entry.format, '\t')
+            && std::getline(fields, entry.toolName, '\t')) {
+            std::getline(fields, entry.toolVersion);
+            result.push_back(std::move(entry));
+        }
+    }
+    return result;
+}
+
+auto convertToCTD(ToolInfo const & doc, ConversionCache & cache) -> std::string {
+    auto key = ConversionCache::key(doc, "ctd");
+    if (auto content = cache.find(key, "ctd")) {
+        ++cache.hitCount;
+        return std::move(*content);
+    }
+    ++cache.missCount;
+    auto content = convertToCTD(doc);
+    cache.store(key, "ctd", doc, content);
+    return content;
+}
+
+auto convertToCWL(ToolInfo const & doc, CWLOptions const & options, ConversionCache & cache) -> std::string {
+    auto hasHooks = std::any_of(options.hooks.begin(), options.hooks.end(), [](auto const & hook) {
+        return static_cast<bool>(hook);
+    });
+    if (hasHooks && options.hooksId.empty()) {
+        ++cache.missCount;
+        return convertToCWL(doc, options);
+    }
+
+    auto key = ConversionCache::key(doc, "cwl", hasHooks ? std::string_view{options.hooksId} : std::string_view{});
+    if (auto content = cache.find(key, "cwl")) {
+        ++cache.hitCount;
+        return std::move(*content);
+    }
+    ++cache.missCount;
+    auto content = convertToCWL(doc, options);
+    cache.store(key, "cwl", doc, content);
+    return content;
+}
+
+} // namespace tdl
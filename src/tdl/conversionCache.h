@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "convertToCWL.h"
+#include "ToolInfo.h"
+
+namespace tdl {
+
+//!\brief a line of the index of a ConversionCache
+struct ConversionCacheEntry {
+    std::string key{};         //!< name of the file, without extension
+    std::string format{};      //!< "ctd" or "cwl", the extension of the file
+    std::string toolName{};    //!< metaInfo.name of the converted tool
+    std::string toolVersion{}; //!< metaInfo.version of the converted tool
+};
+
+/*!\brief a directory of converted documents, so unchanged tools are not converted again
+ *
+ * Each document is stored in its own file `<key>.ctd` or `<key>.cwl`. The key is derived from the
+ * fingerprint of the tool, the version of tdl, the format and, for CWL, `CWLOptions::hooksId`.
+ * So a changed tool, another tdl version or other hooks never yield a stale document.
+ * CWL conversions with hooks but without hooksId are not cached.
+ *
+ * Several processes and threads may share a directory: entries are written to a temporary file which
+ * is renamed to its final name, so readers see either no entry or a complete one. For each new entry
+ * a line is appended to the file `index`, which lists the entries with the name and version of their tool.
+ * The index is informational, the files are looked up directly.
+ *
+ * Failing to write an entry is not an error, the converted document is returned anyway.
+ */
+class ConversionCache {
+public:
+    //!\throws std::filesystem::filesystem_error if the directory can not be created
+    explicit ConversionCache(std::filesystem::path directory);
+
+    ConversionCache(ConversionCache const &)                     = delete;
+    auto operator=(ConversionCache const &) -> ConversionCache & = delete;
+
+    auto directory() const noexcept -> std::filesystem::path const & {
+        return root;
+    }
+
+    //!\brief the cached document, std::nullopt if there is no entry with this key and format
+    auto find(std::string_view key, std::string_view format) const -> std::optional<std::string>;
+
+    //!\brief adds an entry, an existing entry with the same key and format is replaced
+    void store(std::string_view key, std::string_view format, ToolInfo const & doc, std::string_view content);
+
+    //!\brief entries listed in the index, in the order they were added (possibly several times)
+    auto entries() const -> std::vector<ConversionCacheEntry>;
+
+    //!\brief number of conversions served from the cache
+    auto hits() const noexcept -> size_t {
+        return hitCount;
+    }
+
+    //!\brief number of conversions that had to be done
+    auto misses() const noexcept -> size_t {
+        return missCount;
+    }
+
+    //!\brief the key of `doc` converted to `format`, `optionsId` identifies the conversion options
+    static auto key(ToolInfo const & doc, std::string_view format, std::string_view optionsId = {}) -> std::string;
+
+private:
+    friend auto convertToCTD(ToolInfo const & doc, ConversionCache & cache) -> std::string;
+    friend auto convertToCWL(ToolInfo const & doc, CWLOptions const & options, ConversionCache & cache)
+        -> std::string;
+
+    std::filesystem::path root{};
+    std::atomic<size_t>   hitCount{};
+    std::atomic<size_t>   missCount{};
+};
+
+/*!\brief same as `convertToCTD(doc)`, the document is taken from `cache` if possible
+ *
+ * Thread safety: can be called concurrently, also with the same cache.
+ */
+auto convertToCTD(ToolInfo const & doc, ConversionCache & cache) -> std::string;
+
+/*!\brief same as `convertToCWL(doc, options)`, the document is taken from `cache` if possible
+ *
+ * If `options` has hooks, the document is only cached if `options.hooksId` is set.
+ * Thread safety: can be called concurrently, also with the same cache.
+ */
+auto convertToCWL(ToolInfo const & doc, CWLOptions const & options, ConversionCache & cache) -> std::string;
+
+} // namespace tdl
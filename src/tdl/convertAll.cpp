@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "convertAll.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+
+#include "convertToCTD.h"
+
+namespace tdl {
+
+auto convertAll(std::vector<ToolInfo> const & docs,
+                Formats                       formats,
+                CWLOptions const &            cwlOptions,
+                ExecutionPolicy               policy) -> std::vector<ConvertedToolInfo> {
+    auto results = std::vector<ConvertedToolInfo>(docs.size());
+    auto errors  = std::vector<std::exception_ptr>(docs.size());
+
+    auto nextIndex = std::atomic<size_t>{0};
+    auto worker    = [&]() {
+        // documents of a batch are usually alike, the last size avoids most reallocations of the next result
+        auto lastCTDSize = size_t{0};
+        for (auto i = nextIndex++; i < docs.size(); i = nextIndex++) {
+            try {
+                if ((formats & Formats::CTD) == Formats::CTD) {
+                    results[i].ctd.reserve(lastCTDSize);
+                    convertToCTD(docs[i], results[i].ctd);
+                    lastCTDSize = results[i].ctd.size();
+                }
+                if ((formats & Formats::CWL) == Formats::CWL) {
+                    results[i].cwl = convertToCWL(docs[i], cwlOptions);
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    auto threads = policy.threads > 0 ? policy.threads : std::max(std::thread::hardware_concurrency(), 1u);
+    threads      = std::min(threads, docs.size());
+    if (threads <= 1) {
+        worker();
+    } else {
+        auto pool = std::vector<std::thread>{};
+        pool.reserve(threads - 1);
+        for (size_t i{1}; i < threads; ++i) {
+            try {
+                pool.emplace_back(worker);
+            } catch (std::system_error const &) {
+                break; // continue with the threads that could be started
+            }
+        }
+        worker(); // the calling thread participates
+        for (auto & thread : pool) {
+            thread.join();
+        }
+    }
+
+    for (auto const & error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return results;
+}
+
+auto convertAll(std::vector<ToolInfo> const & docs, Formats formats, ExecutionPolicy policy)
+    -> std::vector<ConvertedToolInfo> {
+    // the global callback must not change while the workers are running
+    auto cwlOptions = CWLOptions{};
+    if (post_process_cwl) {
+        cwlOptions.hooks.push_back(post_process_cwl);
+    }
+    return convertAll(docs, formats, cwlOptions, policy);
+}
+
+} // namespace tdl
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "convertToCWL.h"
+#include "ToolInfo.h"
+
+namespace tdl {
+
+//!\brief formats generated by convertAll, can be combined with '|'
+enum class Formats : uint8_t {
+    CTD = 1u << 0,
+    CWL = 1u << 1,
+    All = CTD | CWL
+};
+
+constexpr auto operator|(Formats lhs, Formats rhs) noexcept -> Formats {
+    return static_cast<Formats>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+}
+
+constexpr auto operator&(Formats lhs, Formats rhs) noexcept -> Formats {
+    return static_cast<Formats>(static_cast<uint8_t>(lhs) & static_cast<uint8_t>(rhs));
+}
+
+//!\brief controls how convertAll distributes the documents
+struct ExecutionPolicy {
+    size_t threads{0}; //!\brief number of worker threads, 0 uses std::thread::hardware_concurrency()
+};
+
+//!\brief result of convertAll for a single ToolInfo, formats that were not requested stay empty
+struct ConvertedToolInfo {
+    std::string ctd{};
+    std::string cwl{};
+};
+
+/*!\brief converts many ToolInfo documents into CTD and/or CWL
+ *
+ * The documents are distributed over a pool of worker threads. The CTD of a document is written directly
+ * into its result, reserved with the size of the previous CTD of the same worker.
+ * The results are returned in the order of `docs`.
+ *
+ * Thread safety: the hooks of `cwlOptions` are invoked concurrently from several threads,
+ * so they must be safe to call concurrently. `docs` must not be modified while convertAll is running.
+ * \throws the exception of the first document (in input order) whose conversion failed
+ */
+auto convertAll(std::vector<ToolInfo> const & docs,
+                Formats                       formats,
+                CWLOptions const &            cwlOptions,
+                ExecutionPolicy               policy = {}) -> std::vector<ConvertedToolInfo>;
+
+/*!\brief converts many ToolInfo documents into CTD and/or CWL
+ *
+ * Same as above, with `post_process_cwl` (if set) as only CWL hook. The global callback is
+ * copied once before the workers start.
+ */
+auto convertAll(std::vector<ToolInfo> const & docs, Formats formats, ExecutionPolicy policy = {})
+    -> std::vector<ConvertedToolInfo>;
+
+} // namespace tdl
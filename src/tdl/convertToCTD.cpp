@@ -4,10 +4,14 @@
 
 #include "convertToCTD.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
-#include <iomanip>
-#include <limits>
-#include <sstream>
+#include <numeric>
+#include <string_view>
+
+#include "convertToString.h"
+#include "escapeXML.h"
 
 namespace tdl {
 
@@ -23,90 +27,141 @@ struct overloaded : Ts... {
 template <class... Ts>
 overloaded(Ts...) -> overloaded<Ts...>;
 
-//!\brief replaces all occurrences of a character with a string
-inline auto replace(std::string const & input, char const old_character, std::string const & new_string) {
-    auto out = std::string{};
-    out.reserve(input.size());
+//!\brief sink appending to a string buffer
+struct StringSink {
+    std::string & buffer;
 
-    for (auto chr : input) {
-        if (chr == old_character) {
-            out.append(new_string);
-        } else {
-            out.push_back(chr);
-        }
+    void operator()(std::string_view str) {
+        buffer.append(str);
     }
+    void operator()(char chr) {
+        buffer.push_back(chr);
+    }
+};
 
-    return out;
-}
+//!\brief sink writing into an output stream
+struct StreamSink {
+    std::ostream & stream;
 
-//!\brief required replacements to use strings safely inside XML documents
-inline auto escapeXML(std::string str) {
-    str = replace(str, '&', "&amp;");
-    str = replace(str, '>', "&gt;");
-    str = replace(str, '"', "&quot;");
-    str = replace(str, '<', "&lt;");
-    str = replace(str, '\'', "&apos;");
-    str = replace(str, '\t', "&#x9;");
-    str = replace(str, '\n', "#br#");
-
-    return str;
+    void operator()(std::string_view str) {
+        stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+    void operator()(char chr) {
+        stream.put(chr);
+    }
+};
+
+//!\brief writes `ind` followed by `depth` levels of indentation
+template <typename Sink>
+void writeIndentation(Sink & out, std::string_view ind, size_t depth) {
+    out(ind);
+    for (size_t i{0}; i < depth; ++i) {
+        out("    ");
+    }
 }
 
-//!\brief Converts this structures to a string
-auto XMLNode::generateString(std::vector<std::string> const & order, std::string const & ind) const -> std::string {
-    auto ss = std::stringstream{};
-    ss << ind << "<" << escapeXML(tag);
-
-    // orders the attributes according to the values in `order`
-    auto attributes = [&]() {
-        auto t_attr = this->attr;
-        auto attr2  = std::vector<std::tuple<std::string, std::optional<std::string>>>{};
-
-        for (auto const & o : order) {
-            if (t_attr.count(o) > 0) {
-                attr2.emplace_back(o, t_attr.at(o));
-                t_attr.erase(o);
-            }
+AttributeOrder::AttributeOrder(std::vector<std::string> order) : keys{std::move(order)} {
+    // only the first occurrence of a key is relevant
+    for (size_t i{0}; i < keys.size(); ++i) {
+        if (std::find(keys.begin(), keys.begin() + i, keys[i]) != keys.begin() + i) {
+            keys.erase(keys.begin() + i--);
         }
+    }
 
-        for (auto & [key, v] : t_attr) {
-            attr2.emplace_back(key, v);
-        }
+    sorted.resize(keys.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::sort(sorted.begin(), sorted.end(), [&](size_t lhs, size_t rhs) {
+        return keys[lhs] < keys[rhs];
+    });
+}
 
-        return attr2;
-    }();
+AttributeOrder::AttributeOrder(std::initializer_list<std::string> order) :
+    AttributeOrder{std::vector<std::string>{order}} {}
 
-    // generate all attributes
-    for (auto const & [key, v] : attributes) {
-        ss << " " << key;
-        if (v) {
-            ss << "=\"" << escapeXML(*v) << "\"";
+auto AttributeOrder::rank(std::string_view key) const noexcept -> size_t {
+    auto iter = std::lower_bound(sorted.begin(), sorted.end(), key, [&](size_t index, std::string_view value) {
+        return keys[index] < value;
+    });
+    if (iter != sorted.end() && keys[*iter] == key) {
+        return *iter;
+    }
+    return keys.size();
+}
+
+//!\brief writes a single attribute, attributes without a value are written as plain key
+template <typename Sink>
+void writeAttribute(Sink & out, std::string_view key, std::optional<std::string> const & value) {
+    out(' ');
+    out(key);
+    if (value) {
+        out("=\"");
+        writeEscapedXML(out, *value);
+        out('"');
+    }
+}
+
+//!\brief writes a XMLNode and all its children directly into the sink
+template <typename Sink>
+void writeXMLNode(XMLNode const &        node,
+                  Sink &                 out,
+                  AttributeOrder const & order,
+                  std::string_view       ind,
+                  size_t                 depth) {
+    writeIndentation(out, ind, depth);
+    out('<');
+    writeEscapedXML(out, node.tag);
+
+    // attributes listed in `order` come first, the remaining follow in the (alphabetical) order of the map
+    for (auto const & key : order) {
+        if (auto iter = node.attr.find(key); iter != node.attr.end()) {
+            writeAttribute(out, key, iter->second);
+        }
+    }
+    for (auto const & [key, v] : node.attr) {
+        if (order.rank(key) == order.size()) {
+            writeAttribute(out, key, v);
         }
     }
 
-    assert(children.empty() || !data); // can only have children or data, not both
+    assert(node.children.empty() || !node.data); // can only have children or data, not both
 
-    if (children.empty() && !data) {
-        ss << " />\n";
-    } else if (children.empty()) {
-        ss << ">" << *data << "</" << escapeXML(tag) << ">\n";
+    if (node.children.empty() && !node.data) {
+        out(" />\n");
+    } else if (node.children.empty()) {
+        out('>');
+        out(*node.data);
+        out("</");
+        writeEscapedXML(out, node.tag);
+        out(">\n");
     } else {
-        ss << ">\n";
-        for (auto const & child : children) {
-            ss << child.generateString(order, ind + "    ");
+        out(">\n");
+        for (auto const & child : node.children) {
+            writeXMLNode(child, out, order, ind, depth + 1);
         }
-        ss << ind << "</" << escapeXML(tag) << ">\n";
+        writeIndentation(out, ind, depth);
+        out("</");
+        writeEscapedXML(out, node.tag);
+        out(">\n");
     }
+}
 
-    return ss.str();
+//!\brief Converts this structures to a string
+auto XMLNode::generateString(AttributeOrder const & order, std::string const & ind) const -> std::string {
+    auto out = std::string{};
+    write(out, order, ind);
+    return out;
 }
 
-//!\brief convenience function, to have highest precision for float/double values
-template <typename T>
-auto convertToString(T v) -> std::string {
-    auto ss = std::stringstream{};
-    ss << std::setprecision(std::numeric_limits<std::decay_t<T>>::max_digits10) << v;
-    return ss.str();
+//!\brief Writes this structure into an output stream
+void XMLNode::write(std::ostream & out, AttributeOrder const & order, std::string const & ind) const {
+    auto sink = StreamSink{out};
+    writeXMLNode(*this, sink, order, ind, 0);
+}
+
+//!\brief Appends this structure to a string buffer
+void XMLNode::write(std::string & out, AttributeOrder const & order, std::string const & ind) const {
+    auto sink = StringSink{out};
+    writeXMLNode(*this, sink, order, ind, 0);
 }
 
 // helper function, to generate the restriction attribute
@@ -142,7 +197,7 @@ auto generateValidList(T const & value) -> std::optional<std::string> {
 
     return std::accumulate(++begin(validValues),
                            end(validValues),
-                           *begin(validValues),
+                           std::string{*begin(validValues)},
                            [](auto acc, auto const & next) {
                                acc.push_back(',');
                                acc.append(next);
@@ -156,7 +211,7 @@ auto convertToCTD(Node const & param) -> XMLNode {
     auto xmlNode = XMLNode{/*.tag = */ "NODE",
                            /*.attr = */ {{"name", param.name}, {"description", param.description}}};
 
-    auto tags = param.tags; // copy tags to make them mutable
+    auto tags = param.tags; // copy tags to make them mutable, only free-form tags allocate
 
     // fill xmlNode depending on the actual type
     std::visit(overloaded{
@@ -181,18 +236,18 @@ auto convertToCTD(Node const & param) -> XMLNode {
                    },
                    [&](StringValue value) {
                        xmlNode.tag = "ITEM";
-                       if (tags.count("input file") > 0) {
-                           tags.erase("input file");
+                       if (tags.count(Tag::input_file) > 0) {
+                           tags.erase(Tag::input_file);
                            xmlNode.attr["type"] = "input-file";
                            if (auto v = generateValidList(value))
                                xmlNode.attr["supported_formats"] = v;
-                       } else if (tags.count("output file") > 0) {
-                           tags.erase("output file");
+                       } else if (tags.count(Tag::output_file) > 0) {
+                           tags.erase(Tag::output_file);
                            xmlNode.attr["type"] = "output-file";
                            if (auto v = generateValidList(value))
                                xmlNode.attr["supported_formats"] = v;
-                       } else if (tags.count("output prefix") > 0) {
-                           tags.erase("output prefix");
+                       } else if (tags.count(Tag::output_prefix) > 0) {
+                           tags.erase(Tag::output_prefix);
                            xmlNode.attr["type"] = "output-prefix";
                            if (auto v = generateValidList(value))
                                xmlNode.attr["supported_formats"] = v;
@@ -223,13 +278,13 @@ auto convertToCTD(Node const & param) -> XMLNode {
                    },
                    [&](StringValueList value) {
                        xmlNode.tag = "ITEMLIST";
-                       if (tags.count("input file") > 0) {
-                           tags.erase("input file");
+                       if (tags.count(Tag::input_file) > 0) {
+                           tags.erase(Tag::input_file);
                            xmlNode.attr["type"] = "input-file";
                            if (auto v = generateValidList(value))
                                xmlNode.attr["supported_formats"] = v;
-                       } else if (tags.count("output file") > 0) {
-                           tags.erase("output file");
+                       } else if (tags.count(Tag::output_file) > 0) {
+                           tags.erase(Tag::output_file);
                            xmlNode.attr["type"] = "output-file";
                            if (auto v = generateValidList(value))
                                xmlNode.attr["supported_formats"] = v;
@@ -267,7 +322,8 @@ auto convertToCTD(Node const & param) -> XMLNode {
 
     // add all other tags to the "tags" xml attribute
     if (!tags.empty()) {
-        xmlNode.attr["tags"] = std::accumulate(++begin(tags), end(tags), *begin(tags), [](auto acc, auto const & next) {
+        auto first           = std::string{*tags.begin()};
+        xmlNode.attr["tags"] = std::accumulate(++tags.begin(), tags.end(), first, [](auto acc, auto const & next) {
             acc.push_back(',');
             acc.append(next);
             return acc;
@@ -277,21 +333,21 @@ auto convertToCTD(Node const & param) -> XMLNode {
     return xmlNode;
 }
 
-} // namespace detail
+//!\brief version of the CTD schema
+constexpr auto ctdSchemaVersion = std::string_view{"1.7.0"};
 
-/*!\brief converts a ToolInfo into a string that
- * holds the CTD representation of the given tool
- */
-auto convertToCTD(ToolInfo const & doc) -> std::string {
+//!\brief location of the CTD schema
+constexpr auto ctdSchemaLocation =
+    std::string_view{"https://raw.githubusercontent.com/OpenMS/OpenMS/develop/share/OpenMS/SCHEMAS/Param_1_7_0.xsd"};
+
+//!\brief builds the XMLNode tree of a complete CTD document
+auto convertToXMLNode(ToolInfo const & doc) -> XMLNode {
     auto const & node      = doc.params;
     auto const & tool_info = doc.metaInfo;
 
-    static auto const schema_location = std::string{"/SCHEMAS/Param_1_7_0.xsd"};
-    static auto const schema_version  = std::string{"1.7.0"};
-
     // Write ctd specific stuff
-    auto toolNode = detail::XMLNode{/*.tag = */ "tool",
-                                    /*.attr = */ {{"ctdVersion", "1.7"}}};
+    auto toolNode = XMLNode{/*.tag = */ "tool",
+                            /*.attr = */ {{"ctdVersion", "1.7"}}};
 
     { // Add attributes
         auto emptyOrAttr = [&](std::string attr, std::string const & in) {
@@ -308,10 +364,10 @@ auto convertToCTD(ToolInfo const & doc) -> std::string {
     { // Add tags
         auto emptyOrTag = [&](std::string tag, std::string const & in) {
             if (!in.empty()) {
-                toolNode.children.push_back(detail::XMLNode{/*.tag      =*/std::move(tag),
-                                                            /*.attr     =*/{},
-                                                            /*.children =*/{},
-                                                            /*.data     =*/"<![CDATA[" + in + "]]>"});
+                toolNode.children.push_back(XMLNode{/*.tag      =*/std::move(tag),
+                                                    /*.attr     =*/{},
+                                                    /*.children =*/{},
+                                                    /*.data     =*/"<![CDATA[" + in + "]]>"});
             }
         };
         emptyOrTag("description", tool_info.description);
@@ -320,7 +376,7 @@ auto convertToCTD(ToolInfo const & doc) -> std::string {
     }
 
     { // Add citations
-        auto citationNode = detail::XMLNode{/*.tag = */ "citations"};
+        auto citationNode = XMLNode{/*.tag = */ "citations"};
         for (auto const & [doi, url] : tool_info.citations) {
             citationNode.children.push_back({/*.tag = */ "citation",
                                              /*.attr = */ {{"doi", doi}, {"url", url}}});
@@ -330,22 +386,21 @@ auto convertToCTD(ToolInfo const & doc) -> std::string {
 
     { // Add parameters
         auto paramsNode =
-            detail::XMLNode{/*.tag = */ "PARAMETERS",
-                            /*.attr = */
-                            {{"version", schema_version},
-                             {"xsi:noNamespaceSchemaLocation",
-                              "https://raw.githubusercontent.com/OpenMS/OpenMS/develop/share/OpenMS" + schema_location},
-                             {"xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance"}}};
+            XMLNode{/*.tag = */ "PARAMETERS",
+                    /*.attr = */
+                    {{"version", std::string{ctdSchemaVersion}},
+                     {"xsi:noNamespaceSchemaLocation", std::string{ctdSchemaLocation}},
+                     {"xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance"}}};
 
         for (auto const & child : node) {
-            paramsNode.children.emplace_back(detail::convertToCTD(child));
+            paramsNode.children.emplace_back(convertToCTD(child));
         }
         toolNode.children.push_back(std::move(paramsNode));
     }
 
     // add cli mapping
     if (!doc.cliMapping.empty()) {
-        auto cliNode = detail::XMLNode{/*.tag = */ "cli"};
+        auto cliNode = XMLNode{/*.tag = */ "cli"};
         for (auto const & [optionIdentifier, referenceName] : doc.cliMapping) {
             cliNode.children.push_back(
                 {/*.tag = */ "clielement", /*.attr = */ {{"optionIdentifier", optionIdentifier}}});
@@ -355,28 +410,356 @@ auto convertToCTD(ToolInfo const & doc) -> std::string {
         toolNode.children.emplace_back(std::move(cliNode));
     }
 
-    auto ss = std::stringstream{};
-    ss.precision(std::numeric_limits<double>::digits10);
+    return toolNode;
+}
 
-    static auto order = std::vector<std::string>{"ctdVersion",
-                                                 "version",
-                                                 "name",
-                                                 "value",
-                                                 "type",
-                                                 "description",
-                                                 "docurl",
-                                                 "category",
-                                                 "xsi:noNamespaceSchemaLocation",
-                                                 "xmlns:xsi",
-                                                 "required",
-                                                 "advanced",
-                                                 "restrictions"};
+//!\brief order in which attributes are written, remaining attributes are sorted alphabetically
+AttributeOrder const ctdAttributeOrder{"ctdVersion",
+                                       "version",
+                                       "name",
+                                       "value",
+                                       "type",
+                                       "description",
+                                       "docurl",
+                                       "category",
+                                       "xsi:noNamespaceSchemaLocation",
+                                       "xmlns:xsi",
+                                       "required",
+                                       "advanced",
+                                       "restrictions"};
+
+//!\brief a small list of attributes, which are written without building a XMLNode
+class AttributeList {
+    std::array<std::pair<std::string_view, std::string_view>, 12> attributes{};
+    size_t                                                        count{};
+
+public:
+    void add(std::string_view key, std::string_view value) {
+        assert(count < attributes.size());
+        attributes[count++] = {key, value};
+    }
 
-    // Write ctd specific stuff
-    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-    ss << toolNode.generateString(order);
+    auto begin() {
+        return attributes.begin();
+    }
+    auto end() {
+        return attributes.begin() + count;
+    }
+
+    //!\brief sorts the attributes in the same way as XMLNode::generateString does
+    void sort(AttributeOrder const & order) {
+        std::sort(begin(), end(), [&](auto const & lhs, auto const & rhs) {
+            auto lhsRank = order.rank(lhs.first);
+            auto rhsRank = order.rank(rhs.first);
+            return std::tie(lhsRank, lhs.first) < std::tie(rhsRank, rhs.first);
+        });
+    }
+};
+
+//!\brief writes a single xml tag with its attributes, children are written by `writeChildren`
+template <typename Sink, typename ChildrenCB>
+void writeElement(Sink &             out,
+                  size_t             depth,
+                  std::string_view   tag,
+                  AttributeList &    attributes,
+                  bool               hasChildren,
+                  ChildrenCB const & writeChildren) {
+    attributes.sort(ctdAttributeOrder);
+
+    writeIndentation(out, "", depth);
+    out('<');
+    writeEscapedXML(out, tag);
+    for (auto const & [key, value] : attributes) {
+        out(' ');
+        out(key);
+        out("=\"");
+        writeEscapedXML(out, value);
+        out('"');
+    }
+
+    if (!hasChildren) {
+        out(" />\n");
+        return;
+    }
+    out(">\n");
+    writeChildren();
+    writeIndentation(out, "", depth);
+    out("</");
+    writeEscapedXML(out, tag);
+    out(">\n");
+}
+
+//!\brief writes a xml tag only containing plain data, e.g.: <description><![CDATA[...]]></description>
+template <typename Sink>
+void writeDataElement(Sink & out, size_t depth, std::string_view tag, std::string_view data) {
+    writeIndentation(out, "", depth);
+    out('<');
+    writeEscapedXML(out, tag);
+    out("><![CDATA[");
+    out(data);
+    out("]]></");
+    writeEscapedXML(out, tag);
+    out(">\n");
+}
+
+//!\brief writes a single LISTITEM of an ITEMLIST
+template <typename Sink>
+void writeListItem(Sink & out, size_t depth, std::string_view value) {
+    auto attributes = AttributeList{};
+    attributes.add("value", value);
+    writeElement(out, depth, "LISTITEM", attributes, false, [] {});
+}
+
+/*!\brief writes a Node directly as CTD
+ *
+ * Produces the same output as `convertToCTD(param).write(...)`, but without
+ * materialising the intermediate XMLNode tree. `NodeT` is Node or pmr::Node.
+ */
+template <typename Sink, typename NodeT>
+void writeCTD(NodeT const & param, Sink & out, size_t depth) {
+    using Values = NodeValueTypes<NodeT>;
+
+    auto attributes = AttributeList{};
+    attributes.add("name", param.name);
+    attributes.add("description", param.description);
+
+    auto tag          = std::string_view{"NODE"};
+    auto consumedTag  = std::string_view{}; // special tag, that is converted into the 'type' attribute
+    auto value        = std::string{};
+    auto restrictions = std::optional<std::string>{};
+
+    // special tags of string values, that are converted into the 'type' attribute
+    auto fileType = [&](auto const & v, bool allowPrefix) {
+        restrictions = generateValidList(v);
+        for (auto [special, type] : {std::pair{Tag::input_file, "input-file"},
+                                     std::pair{Tag::output_file, "output-file"},
+                                     std::pair{Tag::output_prefix, "output-prefix"}}) {
+            if ((allowPrefix || special != Tag::output_prefix) && param.tags.count(special) > 0) {
+                consumedTag = Tags::names[static_cast<size_t>(special)];
+                attributes.add("type", type);
+                if (restrictions) {
+                    attributes.add("supported_formats", *restrictions);
+                }
+                return;
+            }
+        }
+        attributes.add("type", "string");
+        if (restrictions) {
+            attributes.add("restrictions", *restrictions);
+        }
+    };
+
+    // fill attributes depending on the actual type
+    std::visit(overloaded{
+                   [&](BoolValue v) {
+                       tag = "ITEM";
+                       attributes.add("type", "bool");
+                       attributes.add("value", v ? "true" : "false");
+                   },
+                   [&](IntValue const & v) {
+                       tag   = "ITEM";
+                       value = std::to_string(v.value);
+                       attributes.add("type", "int");
+                       attributes.add("value", value);
+                       if ((restrictions = generateRestrictions(v)))
+                           attributes.add("restrictions", *restrictions);
+                   },
+                   [&](DoubleValue const & v) {
+                       tag   = "ITEM";
+                       value = convertToString(v.value);
+                       attributes.add("type", "double");
+                       attributes.add("value", value);
+                       if ((restrictions = generateRestrictions(v)))
+                           attributes.add("restrictions", *restrictions);
+                   },
+                   [&](typename Values::StringValue const & v) {
+                       tag = "ITEM";
+                       fileType(v, /*.allowPrefix =*/true);
+                       attributes.add("value", v.value);
+                   },
+                   [&](typename Values::IntValueList const & v) {
+                       tag = "ITEMLIST";
+                       attributes.add("type", "int");
+                       if ((restrictions = generateRestrictions(v)))
+                           attributes.add("restrictions", *restrictions);
+                   },
+                   [&](typename Values::DoubleValueList const & v) {
+                       tag = "ITEMLIST";
+                       attributes.add("type", "double");
+                       if ((restrictions = generateRestrictions(v)))
+                           attributes.add("restrictions", *restrictions);
+                   },
+                   [&](typename Values::StringValueList const & v) {
+                       tag = "ITEMLIST";
+                       fileType(v, /*.allowPrefix =*/false);
+                   },
+                   [&](typename NodeT::Children const &) {},
+               },
+               param.value);
+
+    auto const isNode = (tag == "NODE");
+
+    if (!isNode) {
+        // convert special tags to special xml attributes
+        attributes.add("required", param.tags.count(Tag::required) ? "true" : "false");
+        attributes.add("advanced", param.tags.count(Tag::advanced) ? "true" : "false");
+    }
+
+    // add all other tags to the "tags" xml attribute
+    auto tags = std::string{};
+    for (auto const & t : param.tags) {
+        if (t == consumedTag || (!isNode && (t == "required" || t == "advanced"))) {
+            continue;
+        }
+        if (!tags.empty()) {
+            tags.push_back(',');
+        }
+        tags.append(t);
+    }
+    if (!tags.empty()) {
+        attributes.add("tags", tags);
+    }
+
+    // write the xml tag and the list items or child nodes
+    std::visit(overloaded{
+                   [&](typename Values::StringValueList const & v) {
+                       writeElement(out, depth, tag, attributes, !v.value.empty(), [&] {
+                           for (auto const & e : v.value) {
+                               writeListItem(out, depth + 1, e);
+                           }
+                       });
+                   },
+                   [&](typename NodeT::Children const & children) {
+                       writeElement(out, depth, tag, attributes, !children.empty(), [&] {
+                           for (auto const & child : children) {
+                               writeCTD(child, out, depth + 1);
+                           }
+                       });
+                   },
+                   [&](auto const & v) {
+                       using value_t = std::decay_t<decltype(v)>;
+                       if constexpr (std::is_same_v<value_t, typename Values::IntValueList>
+                                     || std::is_same_v<value_t, typename Values::DoubleValueList>) {
+                           writeElement(out, depth, tag, attributes, !v.value.empty(), [&] {
+                               for (auto const & e : v.value) {
+                                   writeListItem(out, depth + 1, formatNumber(e).view());
+                               }
+                           });
+                       } else {
+                           writeElement(out, depth, tag, attributes, false, [] {});
+                       }
+                   },
+               },
+               param.value);
+}
+
+//!\brief writes a complete CTD document directly into the sink, `ToolInfoT` is ToolInfo or pmr::ToolInfo
+template <typename Sink, typename ToolInfoT>
+void writeCTD(ToolInfoT const & doc, Sink & out) {
+    auto const & tool_info = doc.metaInfo;
+
+    out(ctdHeader);
+
+    auto toolAttributes = AttributeList{};
+    toolAttributes.add("ctdVersion", "1.7");
+    for (auto [attr, in] : {std::pair{"version", &tool_info.version},
+                            std::pair{"name", &tool_info.name},
+                            std::pair{"docurl", &tool_info.docurl},
+                            std::pair{"category", &tool_info.category}}) {
+        if (!in->empty()) {
+            toolAttributes.add(attr, *in);
+        }
+    }
+
+    writeElement(out, 0, "tool", toolAttributes, true, [&] {
+        // Add tags
+        for (auto [tag, in] : {std::pair{"description", &tool_info.description},
+                               std::pair{"manual", &tool_info.description}, //! TODO why does OpenMS do this?
+                               std::pair{"executableName", &tool_info.executableName}}) {
+            if (!in->empty()) {
+                writeDataElement(out, 1, tag, *in);
+            }
+        }
+
+        // Add citations
+        auto citationAttributes = AttributeList{};
+        writeElement(out, 1, "citations", citationAttributes, !tool_info.citations.empty(), [&] {
+            for (auto const & [doi, url] : tool_info.citations) {
+                auto attributes = AttributeList{};
+                attributes.add("doi", doi);
+                attributes.add("url", url);
+                writeElement(out, 2, "citation", attributes, false, [] {});
+            }
+        });
+
+        // Add parameters
+        auto paramsAttributes = AttributeList{};
+        paramsAttributes.add("version", ctdSchemaVersion);
+        paramsAttributes.add("xsi:noNamespaceSchemaLocation", ctdSchemaLocation);
+        paramsAttributes.add("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
+        writeElement(out, 1, "PARAMETERS", paramsAttributes, !doc.params.empty(), [&] {
+            for (auto const & child : doc.params) {
+                writeCTD(child, out, 2);
+            }
+        });
+
+        // add cli mapping
+        if (!doc.cliMapping.empty()) {
+            auto cliAttributes = AttributeList{};
+            writeElement(out, 1, "cli", cliAttributes, true, [&] {
+                for (auto const & mapping : doc.cliMapping) {
+                    auto attributes = AttributeList{};
+                    attributes.add("optionIdentifier", mapping.optionIdentifier);
+                    writeElement(out, 2, "clielement", attributes, true, [&] {
+                        auto mappingAttributes = AttributeList{};
+                        mappingAttributes.add("referenceName", mapping.referenceName);
+                        writeElement(out, 3, "mapping", mappingAttributes, false, [] {});
+                    });
+                }
+            });
+        }
+    });
+}
+
+} // namespace detail
+
+/*!\brief converts a ToolInfo into a string that
+ * holds the CTD representation of the given tool
+ */
+auto convertToCTD(ToolInfo const & doc) -> std::string {
+    auto out = std::string{};
+    convertToCTD(doc, out);
+    return out;
+}
+
+//!\brief writes the CTD representation of the given tool into an output stream
+void convertToCTD(ToolInfo const & doc, std::ostream & out) {
+    auto sink = detail::StreamSink{out};
+    detail::writeCTD(doc, sink);
+}
+
+//!\brief appends the CTD representation of the given tool to a string buffer
+void convertToCTD(ToolInfo const & doc, std::string & out) {
+    auto sink = detail::StringSink{out};
+    detail::writeCTD(doc, sink);
+}
+
+#if TDL_HAS_PMR
+auto convertToCTD(pmr::ToolInfo const & doc) -> std::string {
+    auto out = std::string{};
+    convertToCTD(doc, out);
+    return out;
+}
+
+void convertToCTD(pmr::ToolInfo const & doc, std::ostream & out) {
+    auto sink = detail::StreamSink{out};
+    detail::writeCTD(doc, sink);
+}
 
-    return ss.str();
+void convertToCTD(pmr::ToolInfo const & doc, std::string & out) {
+    auto sink = detail::StringSink{out};
+    detail::writeCTD(doc, sink);
 }
+#endif
 
 } // namespace tdl
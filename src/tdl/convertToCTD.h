@@ -4,14 +4,45 @@
 
 #pragma once
 
+#include <initializer_list>
 #include <map>
+#include <ostream>
 #include <string>
+#include <string_view>
 
 #include "ToolInfo.h"
+#include "pmr.h"
 
 namespace tdl {
 
 namespace detail {
+/*!\brief order in which attributes of a XMLNode are written
+ *
+ * Listed keys are written first in the given order, all remaining attributes follow sorted alphabetically.
+ * The lookup table is built once on construction, so the same order can be applied to many nodes.
+ */
+class AttributeOrder {
+    std::vector<std::string> keys{};   //!\brief keys in the order they are written
+    std::vector<size_t>      sorted{}; //!\brief indices into `keys`, sorted alphabetically for a fast lookup
+
+public:
+    AttributeOrder(std::vector<std::string> order);
+    AttributeOrder(std::initializer_list<std::string> order);
+
+    //!\brief position of `key` in the order, or `size()` if the key is not listed
+    auto rank(std::string_view key) const noexcept -> size_t;
+
+    auto size() const noexcept -> size_t {
+        return keys.size();
+    }
+    auto begin() const noexcept {
+        return keys.begin();
+    }
+    auto end() const noexcept {
+        return keys.end();
+    }
+};
+
 //!\brief Simple structure representing an XML document (or parts of it)
 struct XMLNode {
     std::string                                       tag{};      //!\brief tag of the xml Node, e.g. "div" for <div>
@@ -20,12 +51,54 @@ struct XMLNode {
     std::optional<std::string>                        data{};     //!\brief plain data included in this tag
 
     //!\brief Converts this structures to a string
-    auto generateString(std::vector<std::string> const & order, std::string const & ind = "") const -> std::string;
+    auto generateString(AttributeOrder const & order, std::string const & ind = "") const -> std::string;
+
+    //!\brief Writes this structure into an output stream
+    void write(std::ostream & out, AttributeOrder const & order, std::string const & ind = "") const;
+
+    //!\brief Appends this structure to a string buffer
+    void write(std::string & out, AttributeOrder const & order, std::string const & ind = "") const;
 };
 
+//!\brief converts a Node into an XMLNode
 auto convertToCTD(Node const & param) -> XMLNode;
+
+/*!\brief builds the XMLNode tree of a complete CTD document
+ *
+ * convertToCTD(ToolInfo const &) writes the document directly, this tree is only
+ * required if the document should be inspected or adjusted before writing it.
+ */
+auto convertToXMLNode(ToolInfo const & doc) -> XMLNode;
+
+//!\brief order in which CTD attributes are written, remaining attributes are sorted alphabetically
+extern AttributeOrder const ctdAttributeOrder;
+
+//!\brief header of each CTD document
+inline constexpr auto ctdHeader = std::string_view{"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"};
 } // namespace detail
 
+/*!\brief converts a ToolInfo into a string that
+ * holds the CTD representation of the given tool
+ *
+ * Thread safety: all convertToCTD overloads only read `doc` and can be called concurrently.
+ */
 auto convertToCTD(ToolInfo const & doc) -> std::string;
 
+//!\brief writes the CTD representation of the given tool into an output stream
+void convertToCTD(ToolInfo const & doc, std::ostream & out);
+
+//!\brief appends the CTD representation of the given tool to a string buffer
+void convertToCTD(ToolInfo const & doc, std::string & out);
+
+#if TDL_HAS_PMR
+//!\brief same as `convertToCTD(doc)` for a tool stored in a memory resource
+auto convertToCTD(pmr::ToolInfo const & doc) -> std::string;
+
+//!\brief same as `convertToCTD(doc, out)` for a tool stored in a memory resource
+void convertToCTD(pmr::ToolInfo const & doc, std::ostream & out);
+
+//!\brief same as `convertToCTD(doc, out)` for a tool stored in a memory resource
+void convertToCTD(pmr::ToolInfo const & doc, std::string & out);
+#endif
+
 } // namespace tdl
@@ -4,14 +4,20 @@
 
 #include "convertToCWL.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <filesystem>
-#include <iomanip>
-#include <limits>
 #include <map>
-#include <sstream>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
+#include "cliMappingIndex.h"
+#include "convertToString.h"
 #include "cwl_v1_2.h"
+#include "jsonWriter.h"
+#include "yamlWriter.h"
 
 namespace tdl {
 
@@ -29,15 +35,6 @@ overloaded(Ts...) -> overloaded<Ts...>;
 
 namespace detail {
 
-//!\brief convenience function, to have highest precision for float/double values
-template <typename T>
-auto convertToString(T v) -> std::string {
-    auto ss = std::stringstream{};
-    ss << std::setprecision(std::numeric_limits<std::decay_t<T>>::max_digits10) << v;
-    return ss.str();
-}
-
-
 inline auto simplifyType(YAML::Node type) -> YAML::Node {
     auto is_optional = [](YAML::Node const & node) {
         return node.IsSequence() && node.size() == 2u && node[0].Scalar() == "null";
@@ -65,15 +62,6 @@ inline auto simplifyType(YAML::Node type) -> YAML::Node {
     return type;
 }
 
-inline auto findCLIMapping(std::string const & referenceName, ToolInfo const & doc) -> CLIMapping const * {
-    for (auto const & mapping : doc.cliMapping) {
-        if (mapping.referenceName == referenceName) {
-            return &mapping;
-        }
-    }
-    return nullptr;
-}
-
 template <typename InputType>
 void setIdOrName(InputType & input, std::string const & name) {
     if constexpr (std::is_same_v<InputType, cwl::CommandInputRecordField>
@@ -85,14 +73,14 @@ void setIdOrName(InputType & input, std::string const & name) {
 }
 
 template <typename TypeType, typename InputType, typename InputCB>
-void addInput_impl(TypeType const &   type,
-                   InputType          input,
-                   Node const &       child,
-                   InputCB const &    inputCB,
-                   CLIMapping const * cliMapping) {
+void addInput_impl(TypeType const &                type,
+                   InputType                       input,
+                   Node const &                    child,
+                   InputCB const &                 inputCB,
+                   std::optional<std::string_view> cliMapping) {
     setIdOrName(input, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.count(Tag::required)) {
         input.type = type;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -102,8 +90,8 @@ void addInput_impl(TypeType const &   type,
                                               std::string>>{cwl::CWLType::null, type};
     }
     if constexpr (std::is_same_v<InputType, cwl::CommandInputParameter>) {
-        if ((child.tags.count("required") == 0 && child.tags.count("no_default") == 0)
-            || (child.tags.count("required") && child.tags.count("default_as_hint"))) {
+        if ((child.tags.count(Tag::required) == 0 && child.tags.count(Tag::no_default) == 0)
+            || (child.tags.count(Tag::required) && child.tags.count(Tag::default_as_hint))) {
             // produce a default value
             std::visit(overloaded{
                            [&](BoolValue const & v) {
@@ -116,10 +104,10 @@ void addInput_impl(TypeType const &   type,
                                *input.default_ = v.value;
                            },
                            [&](StringValue const & v) {
-                               if (!child.tags.count("output")
-                                    && !child.tags.count("file")
-                                    && !child.tags.count("directory")
-                                    && !child.tags.count("prefixed")) {
+                               if (!child.tags.count(Tag::output)
+                                    && !child.tags.count(Tag::file)
+                                    && !child.tags.count(Tag::directory)
+                                    && !child.tags.count(Tag::prefixed)) {
 
                                    *input.default_ = v.value;
                                 } else {
@@ -135,7 +123,7 @@ void addInput_impl(TypeType const &   type,
 
     if (cliMapping) {
         auto binding       = cwl::CommandLineBinding{};
-        binding.prefix     = cliMapping->optionIdentifier;
+        binding.prefix     = std::string{*cliMapping};
         input.inputBinding = binding;
     }
 
@@ -143,17 +131,17 @@ void addInput_impl(TypeType const &   type,
 }
 
 template <typename TypeType, typename InputType, typename InputCB>
-void addInputArray_impl(TypeType const &   type,
-                        InputType          input,
-                        Node const &       child,
-                        InputCB const &    inputCB,
-                        CLIMapping const * cliMapping) {
+void addInputArray_impl(TypeType const &                type,
+                        InputType                       input,
+                        Node const &                    child,
+                        InputCB const &                 inputCB,
+                        std::optional<std::string_view> cliMapping) {
     setIdOrName(input, child.name);
 
     auto arrayType  = cwl::CommandInputArraySchema{};
     arrayType.items = type;
 
-    if (child.tags.count("required")) {
+    if (child.tags.count(Tag::required)) {
         input.type = arrayType;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -167,7 +155,7 @@ void addInputArray_impl(TypeType const &   type,
 
     if (cliMapping) {
         auto binding       = cwl::CommandLineBinding{};
-        binding.prefix     = cliMapping->optionIdentifier;
+        binding.prefix     = std::string{*cliMapping};
         input.inputBinding = binding;
     }
 
@@ -175,16 +163,16 @@ void addInputArray_impl(TypeType const &   type,
 }
 
 template <typename TypeType, typename InputType, typename InputCB, typename OutputType, typename OutputCB>
-void addOutput_impl(TypeType const &   type,
-                    InputType          input,
-                    Node const &       child,
-                    InputCB const &    inputCB,
-                    CLIMapping const * cliMapping,
-                    OutputType         output,
-                    OutputCB const &   outputCB) {
+void addOutput_impl(TypeType const &                type,
+                    InputType                       input,
+                    Node const &                    child,
+                    InputCB const &                 inputCB,
+                    std::optional<std::string_view> cliMapping,
+                    OutputType                      output,
+                    OutputCB const &                outputCB) {
     setIdOrName(input, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.count(Tag::required)) {
         input.type = cwl::CWLType::string;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -198,7 +186,7 @@ void addOutput_impl(TypeType const &   type,
 
     if (cliMapping) {
         auto binding       = cwl::CommandLineBinding{};
-        binding.prefix     = cliMapping->optionIdentifier;
+        binding.prefix     = std::string{*cliMapping};
         input.inputBinding = binding;
     }
 
@@ -206,7 +194,7 @@ void addOutput_impl(TypeType const &   type,
 
     setIdOrName(output, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.count(Tag::required)) {
         output.type = type;
     } else {
         output.type = std::vector<std::variant<cwl::CWLType,
@@ -224,17 +212,17 @@ void addOutput_impl(TypeType const &   type,
 }
 
 template <typename TypeType, typename InputType, typename InputCB, typename OutputType, typename OutputCB>
-void addOutputPrefixed_impl(TypeType const &   type,
-                            InputType          input,
-                            Node const &       child,
-                            InputCB const &    inputCB,
-                            CLIMapping const * cliMapping,
-                            OutputType         output,
-                            OutputCB const &   outputCB,
-                            bool               multipleFiles) {
+void addOutputPrefixed_impl(TypeType const &                type,
+                            InputType                       input,
+                            Node const &                    child,
+                            InputCB const &                 inputCB,
+                            std::optional<std::string_view> cliMapping,
+                            OutputType                      output,
+                            OutputCB const &                outputCB,
+                            bool                            multipleFiles) {
     setIdOrName(input, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.count(Tag::required)) {
         input.type = cwl::CWLType::string;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -248,7 +236,7 @@ void addOutputPrefixed_impl(TypeType const &   type,
 
     if (cliMapping) {
         auto binding       = cwl::CommandLineBinding{};
-        binding.prefix     = cliMapping->optionIdentifier;
+        binding.prefix     = std::string{*cliMapping};
         input.inputBinding = binding;
     }
 
@@ -266,7 +254,7 @@ void addOutputPrefixed_impl(TypeType const &   type,
     }
 
     // Add a null, if not required and an array, if a list of files
-    if (!child.tags.count("required")) {
+    if (!child.tags.count(Tag::required)) {
         output.type = std::vector<std::variant<cwl::CWLType,
                                                cwl::CommandOutputRecordSchema,
                                                cwl::CommandOutputEnumSchema,
@@ -298,14 +286,14 @@ template <typename InputType  = cwl::CommandInputParameter,
           typename InputCB,
           typename OutputCB,
           typename BaseCommandCB>
-inline void generateCWL(Node::Children const & children,
-                        ToolInfo const &       doc,
-                        InputCB const &        inputCB,
-                        OutputCB const &       outputCB,
-                        BaseCommandCB const &  baseCommandCB) {
+inline void generateCWL(Node::Children const &  children,
+                        CLIMappingIndex const & cliMappings,
+                        InputCB const &         inputCB,
+                        OutputCB const &        outputCB,
+                        BaseCommandCB const &   baseCommandCB) {
     if constexpr (deep > 0) {
-        for (auto child : children) {
-            auto cliMapping = findCLIMapping(child.name, doc);
+        for (auto const & child : children) {
+            auto cliMapping = cliMappings.find(child.name);
 
             auto addInput = [&](auto type) {
                 addInput_impl(type, InputType{}, child, inputCB, cliMapping);
@@ -341,17 +329,17 @@ inline void generateCWL(Node::Children const & children,
                                addInput(cwl::CWLType::double_);
                            },
                            [&](StringValue const &) {
-                               if (child.tags.count("output")) {
-                                   if (child.tags.count("file")) {
+                               if (child.tags.count(Tag::output)) {
+                                   if (child.tags.count(Tag::file)) {
                                        addOutput(cwl::CWLType::File);
-                                   } else if (child.tags.count("directory")) {
+                                   } else if (child.tags.count(Tag::directory)) {
                                        addOutput(cwl::CWLType::Directory);
-                                   } else if (child.tags.count("prefixed")) {
+                                   } else if (child.tags.count(Tag::prefixed)) {
                                        addOutputPrefixed(cwl::CWLType::File, /*.mutliplieFiles = */ false);
                                    }
-                               } else if (child.tags.count("file")) {
+                               } else if (child.tags.count(Tag::file)) {
                                    addInput(cwl::CWLType::File);
-                               } else if (child.tags.count("directory")) {
+                               } else if (child.tags.count(Tag::directory)) {
                                    addInput(cwl::CWLType::Directory);
                                } else {
                                    addInput(cwl::CWLType::string);
@@ -364,26 +352,26 @@ inline void generateCWL(Node::Children const & children,
                                addInputArray(cwl::CWLType::double_);
                            },
                            [&](StringValueList const &) {
-                               if (child.tags.count("output")) {
-                                   if (child.tags.count("prefixed")) {
+                               if (child.tags.count(Tag::output)) {
+                                   if (child.tags.count(Tag::prefixed)) {
                                        addOutputPrefixed(cwl::CWLType::File, /*.multipleFiles =*/true);
                                    } else {
                                        //! TODO not implemented
                                    }
-                               } else if (child.tags.count("file")) {
+                               } else if (child.tags.count(Tag::file)) {
                                    addInputArray(cwl::CWLType::File);
-                               } else if (child.tags.count("directory")) {
+                               } else if (child.tags.count(Tag::directory)) {
                                    addInputArray(cwl::CWLType::Directory);
                                } else {
                                    addInputArray(cwl::CWLType::string);
                                }
                            },
                            [&](Node::Children const & recursive_children) {
-                               if (child.tags.count("basecommand")) {
+                               if (child.tags.count(Tag::basecommand)) {
                                    baseCommandCB(child.name);
 
                                    generateCWL<InputType, OutputType, deep - 1>(recursive_children,
-                                                                                doc,
+                                                                                cliMappings,
                                                                                 inputCB,
                                                                                 outputCB,
                                                                                 baseCommandCB);
@@ -395,7 +383,7 @@ inline void generateCWL(Node::Children const & children,
 
                                generateCWL<cwl::CommandInputRecordField, cwl::CommandOutputRecordField, (deep - 1)>(
                                    recursive_children,
-                                   doc,
+                                   cliMappings,
                                    [&](auto input) {
                                        inputs.push_back(std::move(input));
                                    },
@@ -406,7 +394,7 @@ inline void generateCWL(Node::Children const & children,
 
                                auto inputType = cwl::CommandInputRecordSchema{};
 
-                               inputType.fields = inputs;
+                               inputType.fields = std::move(inputs);
                                addInput(inputType);
                            },
                        },
@@ -415,9 +403,364 @@ inline void generateCWL(Node::Children const & children,
     }
 }
 
-} // namespace detail
+/*!\brief CWL type of a parameter, written in its simplified form, e.g. "File[]?"
+ *
+ * Records are not simplified, their fields are stored in `CWLTool::fields[record]`.
+ */
+struct CWLTypeInfo {
+    std::string_view name{}; //!< name of the CWLType, empty for records
+    bool             array{};
+    bool             optional{};
+    size_t           record{};
+};
 
-auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
+//!\brief an entry of 'inputs' or of the 'fields' of a record, `NodeT` is Node or pmr::Node
+template <typename NodeT>
+struct CWLInputInfo {
+    NodeT const *                   node;
+    std::optional<std::string_view> cliMapping; //!< optionIdentifier of the parameter
+    CWLTypeInfo                     type;
+    bool                            withDefault; //!< only inputs of the tool itself carry a default value
+};
+
+//!\brief an entry of 'outputs'
+template <typename NodeT>
+struct CWLOutputInfo {
+    NodeT const * node;
+    CWLTypeInfo   type;
+    bool          prefixed; //!< glob matches all files starting with the given name
+};
+
+/*!\brief parameters of a tool, as generated by generateCWL but without the cwl structures
+ *
+ * `fields[0]` are the inputs of the tool, the others the fields of nested records.
+ */
+template <typename NodeT>
+struct CWLTool {
+    std::vector<std::vector<CWLInputInfo<NodeT>>> fields{};
+    std::vector<CWLOutputInfo<NodeT>>             outputs{};
+    std::vector<std::string_view>                 baseCommand{};
+};
+
+//!\brief same traversal as generateCWL, collects the parameters into `tool`
+template <typename NodeT>
+void collectCWL(typename NodeT::Children const & children,
+                CLIMappingIndex const &          cliMappings,
+                CWLTool<NodeT> &                 tool,
+                size_t                           inputs,
+                bool                             isRecord,
+                size_t                           deep) {
+    using Values = NodeValueTypes<NodeT>;
+
+    if (deep == 0) {
+        return;
+    }
+    for (auto const & child : children) {
+        auto cliMapping = cliMappings.find(child.name);
+        auto required   = child.tags.count(Tag::required) > 0;
+
+        auto addInput = [&](CWLTypeInfo type) {
+            type.optional    = !required;
+            auto withDefault = !isRecord
+                               && ((!required && child.tags.count(Tag::no_default) == 0)
+                                   || (required && child.tags.count(Tag::default_as_hint)));
+            tool.fields[inputs].push_back({&child, cliMapping, type, withDefault});
+        };
+
+        auto addOutput = [&](std::string_view type, bool prefixed, bool multipleFiles) {
+            addInput({"string"});
+            tool.fields[inputs].back().withDefault = false;
+            if (!isRecord) {
+                tool.outputs.push_back({&child, {type, multipleFiles, !required}, prefixed});
+            }
+        };
+
+        std::visit(overloaded{
+                       [&](BoolValue const &) {
+                           addInput({"boolean"});
+                       },
+                       [&](IntValue const &) {
+                           addInput({"long"});
+                       },
+                       [&](DoubleValue const &) {
+                           addInput({"double"});
+                       },
+                       [&](typename Values::StringValue const &) {
+                           if (child.tags.count(Tag::output)) {
+                               if (child.tags.count(Tag::file)) {
+                                   addOutput("File", false, false);
+                               } else if (child.tags.count(Tag::directory)) {
+                                   addOutput("Directory", false, false);
+                               } else if (child.tags.count(Tag::prefixed)) {
+                                   addOutput("File", true, false);
+                               }
+                           } else if (child.tags.count(Tag::file)) {
+                               addInput({"File"});
+                           } else if (child.tags.count(Tag::directory)) {
+                               addInput({"Directory"});
+                           } else {
+                               addInput({"string"});
+                           }
+                       },
+                       [&](typename Values::IntValueList const &) {
+                           addInput({"long", true});
+                           tool.fields[inputs].back().withDefault = false;
+                       },
+                       [&](typename Values::DoubleValueList const &) {
+                           addInput({"double", true});
+                           tool.fields[inputs].back().withDefault = false;
+                       },
+                       [&](typename Values::StringValueList const &) {
+                           if (child.tags.count(Tag::output)) {
+                               if (child.tags.count(Tag::prefixed)) {
+                                   addOutput("File", true, true);
+                               }
+                           } else {
+                               auto type = child.tags.count(Tag::file)        ? "File"
+                                           : child.tags.count(Tag::directory) ? "Directory"
+                                                                           : "string";
+                               addInput({type, true});
+                               tool.fields[inputs].back().withDefault = false;
+                           }
+                       },
+                       [&](typename NodeT::Children const & recursive_children) {
+                           if (child.tags.count(Tag::basecommand)) {
+                               tool.baseCommand.push_back(child.name);
+                               collectCWL(recursive_children, cliMappings, tool, inputs, isRecord, deep - 1);
+                               return;
+                           }
+                           auto record = tool.fields.size();
+                           tool.fields.emplace_back();
+                           collectCWL(recursive_children, cliMappings, tool, record, true, deep - 1);
+                           addInput({{}, false, false, record});
+                       },
+                   },
+                   child.value);
+    }
+}
+
+/*!\brief positions of the entries after converting the list into a map
+ *
+ * Like convertListToMap, an entry replaces the value of an earlier entry with the same name.
+ */
+template <typename Entry>
+auto uniqueEntries(std::vector<Entry> const & entries) -> std::vector<size_t> {
+    auto order = std::vector<size_t>{};
+    order.reserve(entries.size());
+
+    // few entries are compared directly, many through a hash map
+    constexpr size_t maxLinear = 16;
+    auto positions = std::unordered_map<std::string_view, size_t>{};
+    if (entries.size() > maxLinear) {
+        positions.reserve(entries.size());
+    }
+
+    for (size_t i{0}; i < entries.size(); ++i) {
+        auto name = std::string_view{entries[i].node->name};
+        if (entries.size() > maxLinear) {
+            auto [iter, inserted] = positions.try_emplace(name, order.size());
+            if (inserted) {
+                order.push_back(i);
+            } else {
+                order[iter->second] = i;
+            }
+            continue;
+        }
+        auto iter = std::find_if(order.begin(), order.end(), [&](size_t j) {
+            return entries[j].node->name == name;
+        });
+        if (iter == order.end()) {
+            order.push_back(i);
+        } else {
+            *iter = i;
+        }
+    }
+    return order;
+}
+
+//!\brief text of a default value
+struct CWLDefault {
+    std::string_view text;
+    bool             isString;        //!< false for numbers and bools
+    bool             isFinite = true; //!< false for `.nan`, `.inf` and `-.inf`
+};
+
+//!\brief the default value addInput_impl would set, `buffer` holds the text of numbers
+template <typename NodeT>
+auto cwlDefault(NodeT const & node, NumberString & buffer) -> std::optional<CWLDefault> {
+    using Values = NodeValueTypes<NodeT>;
+
+    return std::visit(overloaded{
+                          [&](BoolValue const & v) -> std::optional<CWLDefault> {
+                              return CWLDefault{v ? "true" : "false", false};
+                          },
+                          [&](IntValue const & v) -> std::optional<CWLDefault> {
+                              buffer = formatNumber(v.value);
+                              return CWLDefault{buffer.view(), false};
+                          },
+                          [&](DoubleValue const & v) -> std::optional<CWLDefault> {
+                              if (std::isnan(v.value)) {
+                                  return CWLDefault{".nan", false, false};
+                              } else if (std::isinf(v.value)) {
+                                  return CWLDefault{v.value > 0 ? ".inf" : "-.inf", false, false};
+                              }
+                              buffer = formatNumber(v.value);
+                              return CWLDefault{buffer.view(), false};
+                          },
+                          [&](typename Values::StringValue const & v) -> std::optional<CWLDefault> {
+                              // the placeholder "unsupported default" is never written by the reference path
+                              if (node.tags.count(Tag::output) || node.tags.count(Tag::file)
+                                  || node.tags.count(Tag::directory) || node.tags.count(Tag::prefixed)) {
+                                  return std::nullopt;
+                              }
+                              return CWLDefault{v.value, true};
+                          },
+                          [&](auto const &) -> std::optional<CWLDefault> {
+                              return std::nullopt;
+                          },
+                      },
+                      node.value);
+}
+
+template <typename Writer, typename NodeT>
+void writeCWLInputs(Writer & writer, CWLTool<NodeT> const & tool, size_t inputs);
+
+template <typename Writer, typename NodeT>
+void writeCWLType(Writer & writer, CWLTool<NodeT> const & tool, CWLTypeInfo const & type) {
+    if (!type.name.empty()) {
+        auto name = std::string{type.name};
+        name += type.array ? "[]" : "";
+        name += type.optional ? "?" : "";
+        writer.string(name);
+        return;
+    }
+
+    if (type.optional) {
+        writer.beginSeq();
+        writer.string("null");
+    }
+    writer.beginMap();
+    writer.key("fields");
+    writeCWLInputs(writer, tool, type.record);
+    writer.key("type");
+    writer.string("record");
+    writer.endMap();
+    if (type.optional) {
+        writer.endSeq();
+    }
+}
+
+//!\brief writes `tool.fields[inputs]` as map from the name to the parameter, or as empty sequence
+template <typename Writer, typename NodeT>
+void writeCWLInputs(Writer & writer, CWLTool<NodeT> const & tool, size_t inputs) {
+    auto const & entries = tool.fields[inputs];
+    if (entries.empty()) {
+        writer.beginSeq();
+        writer.endSeq();
+        return;
+    }
+
+    auto buffer = NumberString{};
+    writer.beginMap();
+    for (auto i : uniqueEntries(entries)) {
+        auto const & input = entries[i];
+        writer.key(input.node->name);
+        writer.beginMap();
+        writer.key("doc");
+        writer.string(input.node->description);
+        if (input.withDefault) {
+            auto value = cwlDefault(*input.node, buffer);
+            if (value && (value->isFinite || Writer::nonFiniteNumbers)) {
+                writer.key("default");
+                if (value->isString) {
+                    writer.string(value->text);
+                } else {
+                    writer.scalar(value->text);
+                }
+            }
+        }
+        writer.key("type");
+        writeCWLType(writer, tool, input.type);
+        if (input.cliMapping) {
+            writer.key("inputBinding");
+            writer.beginMap();
+            writer.key("prefix");
+            writer.string(*input.cliMapping);
+            writer.endMap();
+        }
+        writer.endMap();
+    }
+    writer.endMap();
+}
+
+template <typename Writer, typename NodeT>
+void writeCWLOutputs(Writer & writer, CWLTool<NodeT> const & tool) {
+    if (tool.outputs.empty()) {
+        writer.beginSeq();
+        writer.endSeq();
+        return;
+    }
+
+    auto glob = std::string{};
+    writer.beginMap();
+    for (auto i : uniqueEntries(tool.outputs)) {
+        auto const & output = tool.outputs[i];
+        writer.key(output.node->name);
+        writer.beginMap();
+        writer.key("type");
+        writeCWLType(writer, tool, output.type);
+        writer.key("outputBinding");
+        writer.beginMap();
+        writer.key("glob");
+        glob = "$(inputs.";
+        glob += output.node->name;
+        glob += output.prefixed ? ")*" : ")";
+        writer.string(glob);
+        writer.endMap();
+        writer.endMap();
+    }
+    writer.endMap();
+}
+
+/*!\brief writes the CWL document of `doc` directly into `writer`
+ *
+ * Produces the same document as tool_to_yaml after type simplification and list to map conversion,
+ * but without building the cwl structures and the YAML::Node tree.
+ * `Writer` receives events like YAMLWriter (beginMap, key, string, ...), `ToolInfoT` is ToolInfo or pmr::ToolInfo.
+ */
+template <typename Writer, typename ToolInfoT>
+void writeCWL(Writer & writer, ToolInfoT const & doc) {
+    using NodeT = typename decltype(ToolInfoT::params)::value_type;
+
+    auto cliMappings = CLIMappingIndex{doc.cliMapping};
+    auto tool        = CWLTool<NodeT>{};
+    tool.fields.emplace_back();
+    collectCWL<NodeT>(doc.params, cliMappings, tool, 0, false, 5);
+
+    writer.beginMap();
+    writer.key("label");
+    writer.string(doc.metaInfo.name);
+    writer.key("doc");
+    writer.string(doc.metaInfo.description);
+    writer.key("inputs");
+    writeCWLInputs(writer, tool, 0);
+    writer.key("outputs");
+    writeCWLOutputs(writer, tool);
+    writer.key("cwlVersion");
+    writer.string("v1.2");
+    writer.key("class");
+    writer.string("CommandLineTool");
+    writer.key("baseCommand");
+    writer.beginSeq();
+    writer.string(std::filesystem::path{doc.metaInfo.executableName}.filename().string());
+    for (auto command : tool.baseCommand) {
+        writer.string(command);
+    }
+    writer.endSeq();
+    writer.endMap();
+}
+
+auto convertToCWLTool(ToolInfo const & doc) -> cwl::CommandLineTool {
     auto & tool_info = doc.metaInfo;
 
     auto tool       = cwl::CommandLineTool{};
@@ -438,9 +781,9 @@ auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
     auto baseCommand = std::vector<std::string>{};
     baseCommand.push_back(std::filesystem::path{tool_info.executableName}.filename().string());
 
-    detail::generateCWL(
+    generateCWL(
         doc.params,
-        doc,
+        CLIMappingIndex{doc.cliMapping},
         [&](auto input) {
             tool.inputs->push_back(std::move(input));
         },
@@ -452,14 +795,23 @@ auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
         });
 
     tool.baseCommand = std::move(baseCommand);
+    return tool;
+}
+
+} // namespace detail
 
-    return w3id_org::cwl::toYaml(tool, {});
+auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
+    // doubles are written like the direct writer does, yaml-cpp would write max_digits10 digits
+    auto config         = w3id_org::cwl::store_config{};
+    config.formatDouble = [](double v) {
+        return detail::formatNumber(v).str();
+    };
+    return w3id_org::cwl::toYaml(detail::convertToCWLTool(doc), config);
 }
 
-/*!\brief converts a ToolInfo into a string that
- * holds the CWL representation of the given tool
- */
-auto convertToCWL(ToolInfo const & doc) -> std::string {
+namespace detail {
+
+auto convertToCWLReference(ToolInfo const & doc, CWLOptions const & options) -> std::string {
     auto yaml = tool_to_yaml(doc);
 
     // function to traverse yaml tree and executes 'simplifyType' on all nodes with name 'type'
@@ -486,8 +838,10 @@ auto convertToCWL(ToolInfo const & doc) -> std::string {
     }
 
     // post process generated cwl yaml file
-    if (post_process_cwl) {
-        post_process_cwl(yaml);
+    for (auto const & hook : options.hooks) {
+        if (hook) {
+            hook(yaml);
+        }
     }
 
     YAML::Emitter out;
@@ -495,4 +849,82 @@ auto convertToCWL(ToolInfo const & doc) -> std::string {
     return out.c_str();
 }
 
+} // namespace detail
+
+/*!\brief converts a ToolInfo into a string that
+ * holds the CWL representation of the given tool
+ */
+auto convertToCWL(ToolInfo const & doc, CWLOptions const & options) -> std::string {
+    // hooks work on the YAML::Node tree, only in that case it has to be built
+    auto hasHooks = std::any_of(options.hooks.begin(), options.hooks.end(), [](auto const & hook) {
+        return static_cast<bool>(hook);
+    });
+    if (hasHooks) {
+        return detail::convertToCWLReference(doc, options);
+    }
+
+    auto out    = std::string{};
+    auto writer = detail::YAMLWriter{out};
+    detail::writeCWL(writer, doc);
+    return out;
+}
+
+/*!\brief converts a ToolInfo into a string that
+ * holds the CWL representation of the given tool
+ */
+auto convertToCWL(ToolInfo const & doc) -> std::string {
+    auto options = CWLOptions{};
+    if (post_process_cwl) {
+        options.hooks.push_back(post_process_cwl);
+    }
+    return convertToCWL(doc, options);
+}
+
+#if TDL_HAS_PMR
+/*!\brief converts a pmr::ToolInfo into a string that
+ * holds the CWL representation of the given tool
+ */
+auto convertToCWL(pmr::ToolInfo const & doc, CWLOptions const & options) -> std::string {
+    // hooks need the YAML::Node tree, which is only built from a ToolInfo
+    auto hasHooks = std::any_of(options.hooks.begin(), options.hooks.end(), [](auto const & hook) {
+        return static_cast<bool>(hook);
+    });
+    if (hasHooks) {
+        return detail::convertToCWLReference(pmr::toToolInfo(doc), options);
+    }
+
+    auto out    = std::string{};
+    auto writer = detail::YAMLWriter{out};
+    detail::writeCWL(writer, doc);
+    return out;
+}
+
+/*!\brief converts a pmr::ToolInfo into a string that
+ * holds the CWL representation of the given tool
+ */
+auto convertToCWL(pmr::ToolInfo const & doc) -> std::string {
+    auto options = CWLOptions{};
+    if (post_process_cwl) {
+        options.hooks.push_back(post_process_cwl);
+    }
+    return convertToCWL(doc, options);
+}
+#endif
+
+auto convertToCWLJson(ToolInfo const & doc) -> std::string {
+    auto out    = std::string{};
+    auto writer = detail::JSONWriter{out};
+    detail::writeCWL(writer, doc);
+    return out;
+}
+
+#if TDL_HAS_PMR
+auto convertToCWLJson(pmr::ToolInfo const & doc) -> std::string {
+    auto out    = std::string{};
+    auto writer = detail::JSONWriter{out};
+    detail::writeCWL(writer, doc);
+    return out;
+}
+#endif
+
 } // namespace tdl
@@ -5,10 +5,13 @@
 #pragma once
 
 #include <functional>
+#include <string>
+#include <vector>
 
 #include <yaml-cpp/node/node.h>
 
 #include "ToolInfo.h"
+#include "pmr.h"
 
 namespace tdl {
 
@@ -16,12 +19,79 @@ namespace tdl {
  *
  * This callback allows to adjust the exported yaml file to add/change/remove
  * cwl entries, which currently aren't controllable via tdl itself.
+ * It is only used by `convertToCWL(doc)`, which has no CWLOptions. It must not be
+ * modified while such a conversion is running in another thread.
  */
 inline std::function<void(YAML::Node &)> post_process_cwl;
 
+//!\brief a callback adjusting the generated CWL document
+using CWLHook = std::function<void(YAML::Node &)>;
+
+//!\brief options of a single CWL conversion
+struct CWLOptions {
+    //!\brief callbacks that are applied in order to the generated document, the global `post_process_cwl` is not used
+    std::vector<CWLHook> hooks{};
+
+    //!\brief identifies `hooks` for a ConversionCache, documents converted with hooks but without id are not cached
+    std::string hooksId{};
+};
+
 /*!\brief converts a ToolInfo into a string that
  * holds the CWL representation of the given tool
+ *
+ * Same as `convertToCWL(doc, options)` with `post_process_cwl` (if set) as only hook.
+ * \throws std::runtime_error if two entries of `doc.cliMapping` have the same referenceName
+ * Thread safety: can be called concurrently, as long as `post_process_cwl` is not modified
+ * at the same time and the callback itself is safe to call concurrently.
  */
 auto convertToCWL(ToolInfo const & doc) -> std::string;
 
+/*!\brief converts a ToolInfo into a string that
+ * holds the CWL representation of the given tool
+ *
+ * Without hooks the YAML text is written directly, the YAML::Node tree is only built if hooks are given.
+ * The quoting of strings follows `YAML::Emitter` of the pinned yaml-cpp version, see detail::YAMLWriter.
+ * Thread safety: only reads `doc` and `options`, concurrent calls with different options do not interfere.
+ * Hooks shared between threads must be safe to call concurrently.
+ * \throws std::runtime_error if two entries of `doc.cliMapping` have the same referenceName
+ */
+auto convertToCWL(ToolInfo const & doc, CWLOptions const & options) -> std::string;
+
+#if TDL_HAS_PMR
+//!\brief same as `convertToCWL(doc)` for a tool stored in a memory resource
+auto convertToCWL(pmr::ToolInfo const & doc) -> std::string;
+
+/*!\brief same as `convertToCWL(doc, options)` for a tool stored in a memory resource
+ *
+ * Without hooks the document is written directly from `doc`. Hooks require the YAML::Node tree,
+ * in that case `doc` is copied into a ToolInfo first.
+ */
+auto convertToCWL(pmr::ToolInfo const & doc, CWLOptions const & options) -> std::string;
+#endif
+
+/*!\brief converts a ToolInfo into the CWL representation as compact JSON
+ *
+ * Same document as `convertToCWL(doc, {})`, without hooks and `post_process_cwl`. JSON has no numbers for NaN
+ * and infinity, defaults of DoubleValues that are not finite are omitted.
+ * \throws std::runtime_error if two entries of `doc.cliMapping` have the same referenceName
+ */
+auto convertToCWLJson(ToolInfo const & doc) -> std::string;
+
+#if TDL_HAS_PMR
+//!\brief same as `convertToCWLJson(doc)` for a tool stored in a memory resource
+auto convertToCWLJson(pmr::ToolInfo const & doc) -> std::string;
+#endif
+
+namespace detail {
+
+/*!\brief converts a ToolInfo into CWL by building the cwl structures and a YAML::Node tree
+ *
+ * Used by `convertToCWL` if hooks are given. Without hooks `convertToCWL` writes the document
+ * directly and must produce the same document, this is the reference for testing it. With the pinned yaml-cpp
+ * version both strings are identical, other versions may quote some strings differently.
+ */
+auto convertToCWLReference(ToolInfo const & doc, CWLOptions const & options) -> std::string;
+
+} // namespace detail
+
 } // namespace tdl
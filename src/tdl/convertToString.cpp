@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "convertToString.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+namespace tdl::detail {
+
+namespace {
+
+/*!\brief writes the shortest round trip representation in the form "[-]d[.ddd]e(+|-)xx"
+ *
+ * Uses floating point std::to_chars if the standard library provides it, otherwise
+ * the precision of snprintf is increased until the value parses back identically.
+ */
+auto scientificShortest(double v, std::array<char, 32> & buffer) noexcept -> size_t {
+#if defined(__cpp_lib_to_chars)
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), v, std::chars_format::scientific);
+    return static_cast<size_t>(result.ptr - buffer.data());
+#else
+    auto length = 0;
+    for (auto precision = 0; precision < std::numeric_limits<double>::max_digits10; ++precision) {
+        length = std::snprintf(buffer.data(), buffer.size(), "%.*e", precision, v);
+        if (std::strtod(buffer.data(), nullptr) == v) {
+            break;
+        }
+    }
+    return static_cast<size_t>(length);
+#endif
+}
+
+} // namespace
+
+auto formatNumber(double v) noexcept -> NumberString {
+    auto scientific = std::array<char, 32>{};
+    auto length     = scientificShortest(v, scientific);
+    if (!std::isfinite(v)) {
+        return {scientific.data(), scientific.data() + length};
+    }
+
+    // split into sign, significant digits and decimal exponent
+    auto str      = std::string_view{scientific.data(), length};
+    auto ePos     = str.find('e');
+    auto mantissa = str.substr(0, ePos);
+    auto exponent = std::atoi(scientific.data() + ePos + 1);
+
+    auto digits      = std::array<char, 32>{};
+    auto nbrOfDigits = size_t{0};
+    for (auto c : mantissa) {
+        if (c >= '0' && c <= '9') {
+            digits[nbrOfDigits++] = c;
+        }
+    }
+
+    // scientific notation is already in the right layout
+    if (exponent < -4 || exponent >= 17) {
+        return {scientific.data(), scientific.data() + length};
+    }
+
+    auto buffer = std::array<char, 32>{};
+    auto out    = buffer.data();
+    if (mantissa.front() == '-') {
+        *out++ = '-';
+    }
+    if (exponent < 0) {
+        *out++ = '0';
+        *out++ = '.';
+        for (auto i{exponent + 1}; i < 0; ++i) {
+            *out++ = '0';
+        }
+        out = std::copy(digits.data(), digits.data() + nbrOfDigits, out);
+    } else {
+        auto integerDigits = static_cast<size_t>(exponent) + 1;
+        for (size_t i{0}; i < integerDigits; ++i) {
+            *out++ = i < nbrOfDigits ? digits[i] : '0';
+        }
+        if (nbrOfDigits > integerDigits) {
+            *out++ = '.';
+            out    = std::copy(digits.data() + integerDigits, digits.data() + nbrOfDigits, out);
+        }
+    }
+    return {buffer.data(), out};
+}
+
+auto parseDouble(std::string_view str) noexcept -> std::optional<double> {
+    if (!str.empty() && str.front() == '+') {
+        str.remove_prefix(1);
+    }
+    if (str.empty()) {
+        return std::nullopt;
+    }
+#if defined(__cpp_lib_to_chars)
+    auto value  = double{};
+    auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (result.ec != std::errc{} || result.ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+#else
+    // strtod requires a null terminated string
+    auto buffer = std::array<char, 64>{};
+    if (str.size() >= buffer.size() || std::isspace(static_cast<unsigned char>(str.front()))) {
+        return std::nullopt;
+    }
+    std::copy(str.begin(), str.end(), buffer.data());
+    char * end{};
+    auto   value = std::strtod(buffer.data(), &end);
+    if (end != buffer.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+#endif
+}
+
+} // namespace tdl::detail
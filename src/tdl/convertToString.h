@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace tdl::detail {
+
+//!\brief a formatted number, stored on the stack
+class NumberString {
+    std::array<char, 32> buffer{};
+    size_t               length{};
+
+public:
+    NumberString() = default;
+    NumberString(char const * first, char const * last) noexcept : length{static_cast<size_t>(last - first)} {
+        std::copy(first, last, buffer.data());
+    }
+
+    auto view() const noexcept -> std::string_view {
+        return {buffer.data(), length};
+    }
+    auto str() const -> std::string {
+        return std::string{view()};
+    }
+};
+
+/*!\brief shortest representation of `v` that parses back to the identical value
+ *
+ * The layout follows `%g`: fixed notation for decimal exponents in [-4, 17), scientific notation otherwise.
+ */
+auto formatNumber(double v) noexcept -> NumberString;
+
+//!\brief decimal representation of an integer
+template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+auto formatNumber(T v) noexcept -> NumberString {
+    auto buffer = std::array<char, 32>{};
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), v);
+    return {buffer.data(), result.ptr};
+}
+
+//!\brief convenience function, to have the shortest exact representation of int/double values
+template <typename T>
+auto convertToString(T v) -> std::string {
+    return formatNumber(v).str();
+}
+
+//!\brief parses a complete decimal number, std::nullopt if `str` is not a valid number
+auto parseDouble(std::string_view str) noexcept -> std::optional<double>;
+
+//!\brief parses a complete decimal integer, std::nullopt if `str` is not a valid integer or out of range
+template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+auto parseInteger(std::string_view str) noexcept -> std::optional<T> {
+    auto value  = T{};
+    auto first  = str.data() + (!str.empty() && str.front() == '+');
+    auto result = std::from_chars(first, str.data() + str.size(), value);
+    if (str.empty() || result.ec != std::errc{} || result.ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+} // namespace tdl::detail
@@ -0,0 +1,8 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+// With TDL_CWL_COMPILED the serialisation of the CWL structs is compiled once here, otherwise cwl_v1_2.h defines it
+#if TDL_CWL_COMPILED
+#include "cwl_v1_2_impl.h"
+#endif
@@ -0,0 +1,6008 @@
+// SPDX-FileCopyrightText: Copyright 2016-2024 CWL Project Contributors
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+/* This file was generated using schema-salad code generator.
+ *
+ * The embedded document is subject to the license of the original schema.
+ */
+
+/* The definitions of the serialisation declared in cwl_v1_2.h
+ *
+ * Included at the end of cwl_v1_2.h, or compiled once by cwl_v1_2.cpp if TDL_CWL_COMPILED is set.
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include "cwl_v1_2.h"
+
+TDL_CWL_INLINE w3id_org::cwl::salad::Documented::~Documented() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::salad::Documented::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Documented");
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::salad::Documented::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+}
+TDL_CWL_INLINE auto w3id_org::cwl::salad::RecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("RecordField");
+    }
+    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::salad::RecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::salad::Documented::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::salad::RecordField>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::RecordField> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::salad::RecordField{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::salad::RecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("RecordSchema");
+    }
+    {
+         auto member = toYaml(*fields, config);
+         member = convertListToMap(member, "name", "type", config);
+        addYamlField(n, "fields", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::salad::RecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *fields);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::salad::RecordSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::RecordSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::salad::RecordSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) {
+        if (tryFromYaml(n["fields"], *res.fields)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::salad::EnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("EnumSchema");
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*symbols, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "symbols", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::salad::EnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["symbols"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *symbols);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::salad::EnumSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::EnumSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::salad::EnumSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.symbols)::value_t>::value) {
+        if (tryFromYaml(n["symbols"], *res.symbols)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::salad::ArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ArraySchema");
+    }
+    {
+         auto member = toYaml(*items, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "items", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::salad::ArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["items"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *items);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::salad::ArraySchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::ArraySchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::salad::ArraySchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) {
+        if (tryFromYaml(n["items"], *res.items)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::File::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("File");
+    }
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*location, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "location", member);
+    }
+    {
+         auto member = toYaml(*path, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "path", member);
+    }
+    {
+         auto member = toYaml(*basename, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "basename", member);
+    }
+    {
+         auto member = toYaml(*dirname, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dirname", member);
+    }
+    {
+         auto member = toYaml(*nameroot, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "nameroot", member);
+    }
+    {
+         auto member = toYaml(*nameext, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "nameext", member);
+    }
+    {
+         auto member = toYaml(*checksum, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "checksum", member);
+    }
+    {
+         auto member = toYaml(*size, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "size", member);
+    }
+    {
+         auto member = toYaml(*secondaryFiles, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "secondaryFiles", member);
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    {
+         auto member = toYaml(*contents, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "contents", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::File::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["location"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *location);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["path"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *path);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["basename"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *basename);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dirname"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dirname);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["nameroot"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *nameroot);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["nameext"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *nameext);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["checksum"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *checksum);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["size"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *size);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *secondaryFiles);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["contents"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *contents);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::File>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::File> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::File{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.location)::value_t>::value) {
+        if (tryFromYaml(n["location"], *res.location)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.path)::value_t>::value) {
+        if (tryFromYaml(n["path"], *res.path)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.basename)::value_t>::value) {
+        if (tryFromYaml(n["basename"], *res.basename)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dirname)::value_t>::value) {
+        if (tryFromYaml(n["dirname"], *res.dirname)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.nameroot)::value_t>::value) {
+        if (tryFromYaml(n["nameroot"], *res.nameroot)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.nameext)::value_t>::value) {
+        if (tryFromYaml(n["nameext"], *res.nameext)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.checksum)::value_t>::value) {
+        if (tryFromYaml(n["checksum"], *res.checksum)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.size)::value_t>::value) {
+        if (tryFromYaml(n["size"], *res.size)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) {
+        if (tryFromYaml(n["secondaryFiles"], *res.secondaryFiles)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) {
+        if (tryFromYaml(n["format"], *res.format)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.contents)::value_t>::value) {
+        if (tryFromYaml(n["contents"], *res.contents)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Directory::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Directory");
+    }
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*location, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "location", member);
+    }
+    {
+         auto member = toYaml(*path, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "path", member);
+    }
+    {
+         auto member = toYaml(*basename, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "basename", member);
+    }
+    {
+         auto member = toYaml(*listing, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "listing", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Directory::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["location"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *location);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["path"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *path);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["basename"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *basename);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["listing"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *listing);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Directory>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Directory> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::Directory{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.location)::value_t>::value) {
+        if (tryFromYaml(n["location"], *res.location)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.path)::value_t>::value) {
+        if (tryFromYaml(n["path"], *res.path)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.basename)::value_t>::value) {
+        if (tryFromYaml(n["basename"], *res.basename)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.listing)::value_t>::value) {
+        if (tryFromYaml(n["listing"], *res.listing)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::Labeled::~Labeled() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Labeled::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Labeled");
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Labeled::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::Identified::~Identified() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Identified::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Identified");
+    }
+    {
+         auto member = toYaml(*id, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "id", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Identified::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["id"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *id);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::LoadContents::~LoadContents() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::LoadContents::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("LoadContents");
+    }
+    {
+         auto member = toYaml(*loadContents, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadContents", member);
+    }
+    {
+         auto member = toYaml(*loadListing, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadListing", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::LoadContents::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadContents);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadListing);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::FieldBase::~FieldBase() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::FieldBase::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("FieldBase");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
+    {
+         auto member = toYaml(*secondaryFiles, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "secondaryFiles", member);
+    }
+    {
+         auto member = toYaml(*streamable, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "streamable", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::FieldBase::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Labeled::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *secondaryFiles);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["streamable"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *streamable);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::InputFormat::~InputFormat() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputFormat::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputFormat");
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputFormat::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::OutputFormat::~OutputFormat() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputFormat::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputFormat");
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputFormat::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::Parameter::~Parameter() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Parameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Parameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::FieldBase::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Parameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::FieldBase::fromYaml(n);
+    w3id_org::cwl::salad::Documented::fromYaml(n);
+    w3id_org::cwl::cwl::Identified::fromYaml(n);
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputBinding::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputBinding");
+    }
+    {
+         auto member = toYaml(*loadContents, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadContents", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputBinding::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadContents);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputBinding>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputBinding> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InputBinding{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadContents)::value_t>::value) {
+        if (tryFromYaml(n["loadContents"], *res.loadContents)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::IOSchema::~IOSchema() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::IOSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("IOSchema");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::IOSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Labeled::fromYaml(n);
+    w3id_org::cwl::salad::Documented::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::InputSchema::~InputSchema() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputSchema");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::IOSchema::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::IOSchema::fromYaml(n);
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::OutputSchema::~OutputSchema() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputSchema");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::IOSchema::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::IOSchema::fromYaml(n);
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputRecordField");
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*secondaryFiles, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "secondaryFiles", member);
+    }
+    {
+         auto member = toYaml(*streamable, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "streamable", member);
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    {
+         auto member = toYaml(*loadContents, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadContents", member);
+    }
+    {
+         auto member = toYaml(*loadListing, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadListing", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *secondaryFiles);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["streamable"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *streamable);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadContents);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadListing);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputRecordField>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputRecordField> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InputRecordField{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) {
+        if (tryFromYaml(n["secondaryFiles"], *res.secondaryFiles)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) {
+        if (tryFromYaml(n["streamable"], *res.streamable)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) {
+        if (tryFromYaml(n["format"], *res.format)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadContents)::value_t>::value) {
+        if (tryFromYaml(n["loadContents"], *res.loadContents)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadListing)::value_t>::value) {
+        if (tryFromYaml(n["loadListing"], *res.loadListing)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputRecordSchema");
+    }
+    {
+         auto member = toYaml(*fields, config);
+         member = convertListToMap(member, "name", "type", config);
+        addYamlField(n, "fields", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *fields);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputRecordSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputRecordSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InputRecordSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) {
+        if (tryFromYaml(n["fields"], *res.fields)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputEnumSchema");
+    }
+    n = mergeYaml(n, w3id_org::cwl::salad::EnumSchema::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::InputSchema::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::salad::EnumSchema::fromYaml(n);
+    w3id_org::cwl::cwl::InputSchema::fromYaml(n);
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputEnumSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputEnumSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InputEnumSchema{};
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputArraySchema");
+    }
+    {
+         auto member = toYaml(*items, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "items", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["items"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *items);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputArraySchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputArraySchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InputArraySchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) {
+        if (tryFromYaml(n["items"], *res.items)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputRecordField");
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*secondaryFiles, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "secondaryFiles", member);
+    }
+    {
+         auto member = toYaml(*streamable, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "streamable", member);
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *secondaryFiles);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["streamable"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *streamable);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputRecordField>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputRecordField> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::OutputRecordField{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) {
+        if (tryFromYaml(n["secondaryFiles"], *res.secondaryFiles)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) {
+        if (tryFromYaml(n["streamable"], *res.streamable)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) {
+        if (tryFromYaml(n["format"], *res.format)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputRecordSchema");
+    }
+    {
+         auto member = toYaml(*fields, config);
+         member = convertListToMap(member, "name", "type", config);
+        addYamlField(n, "fields", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *fields);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputRecordSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputRecordSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::OutputRecordSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) {
+        if (tryFromYaml(n["fields"], *res.fields)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputEnumSchema");
+    }
+    n = mergeYaml(n, w3id_org::cwl::salad::EnumSchema::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::OutputSchema::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::salad::EnumSchema::fromYaml(n);
+    w3id_org::cwl::cwl::OutputSchema::fromYaml(n);
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputEnumSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputEnumSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::OutputEnumSchema{};
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputArraySchema");
+    }
+    {
+         auto member = toYaml(*items, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "items", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["items"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *items);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputArraySchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputArraySchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::OutputArraySchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) {
+        if (tryFromYaml(n["items"], *res.items)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::InputParameter::~InputParameter() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Parameter::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::InputFormat::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::LoadContents::toYaml(config));
+    {
+         auto member = toYaml(*default_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "default", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Parameter::fromYaml(n);
+    w3id_org::cwl::cwl::InputFormat::fromYaml(n);
+    w3id_org::cwl::cwl::LoadContents::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["default"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *default_);
+    }
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::OutputParameter::~OutputParameter() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OutputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Parameter::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::OutputFormat::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Parameter::fromYaml(n);
+    w3id_org::cwl::cwl::OutputFormat::fromYaml(n);
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::ProcessRequirement::~ProcessRequirement() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ProcessRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ProcessRequirement");
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ProcessRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::Process::~Process() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Process::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Process");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
+    {
+         auto member = toYaml(*inputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "inputs", member);
+    }
+    {
+         auto member = toYaml(*outputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "outputs", member);
+    }
+    {
+         auto member = toYaml(*requirements, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "requirements", member);
+    }
+    {
+         auto member = toYaml(*hints, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "hints", member);
+    }
+    {
+         auto member = toYaml(*cwlVersion, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "cwlVersion", member);
+    }
+    {
+         auto member = toYaml(*intent, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "intent", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Process::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Identified::fromYaml(n);
+    w3id_org::cwl::cwl::Labeled::fromYaml(n);
+    w3id_org::cwl::salad::Documented::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *requirements);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["hints"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *hints);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *cwlVersion);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["intent"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *intent);
+    }
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InlineJavascriptRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InlineJavascriptRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*expressionLib, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "expressionLib", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InlineJavascriptRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["expressionLib"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *expressionLib);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InlineJavascriptRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InlineJavascriptRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InlineJavascriptRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.expressionLib)::value_t>::value) {
+        if (tryFromYaml(n["expressionLib"], *res.expressionLib)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::CommandInputSchema::~CommandInputSchema() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandInputSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandInputSchema");
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandInputSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::SchemaDefRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("SchemaDefRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*types, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "types", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::SchemaDefRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["types"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *types);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SchemaDefRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SchemaDefRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::SchemaDefRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.types)::value_t>::value) {
+        if (tryFromYaml(n["types"], *res.types)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::SecondaryFileSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("SecondaryFileSchema");
+    }
+    {
+         auto member = toYaml(*pattern, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "pattern", member);
+    }
+    {
+         auto member = toYaml(*required, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "required", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::SecondaryFileSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["pattern"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *pattern);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["required"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *required);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SecondaryFileSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SecondaryFileSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::SecondaryFileSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.pattern)::value_t>::value) {
+        if (tryFromYaml(n["pattern"], *res.pattern)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.required)::value_t>::value) {
+        if (tryFromYaml(n["required"], *res.required)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::LoadListingRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("LoadListingRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*loadListing, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadListing", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::LoadListingRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadListing);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::LoadListingRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::LoadListingRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::LoadListingRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadListing)::value_t>::value) {
+        if (tryFromYaml(n["loadListing"], *res.loadListing)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::EnvironmentDef::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("EnvironmentDef");
+    }
+    {
+         auto member = toYaml(*envName, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "envName", member);
+    }
+    {
+         auto member = toYaml(*envValue, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "envValue", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::EnvironmentDef::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["envName"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *envName);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["envValue"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *envValue);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::EnvironmentDef>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::EnvironmentDef> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::EnvironmentDef{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.envName)::value_t>::value) {
+        if (tryFromYaml(n["envName"], *res.envName)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.envValue)::value_t>::value) {
+        if (tryFromYaml(n["envValue"], *res.envValue)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandLineBinding::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandLineBinding");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::InputBinding::toYaml(config));
+    {
+         auto member = toYaml(*position, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "position", member);
+    }
+    {
+         auto member = toYaml(*prefix, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "prefix", member);
+    }
+    {
+         auto member = toYaml(*separate, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "separate", member);
+    }
+    {
+         auto member = toYaml(*itemSeparator, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "itemSeparator", member);
+    }
+    {
+         auto member = toYaml(*valueFrom, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "valueFrom", member);
+    }
+    {
+         auto member = toYaml(*shellQuote, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "shellQuote", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandLineBinding::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::InputBinding::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["position"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *position);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["prefix"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *prefix);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["separate"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *separate);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["itemSeparator"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *itemSeparator);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["valueFrom"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *valueFrom);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["shellQuote"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *shellQuote);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineBinding>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineBinding> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandLineBinding{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.position)::value_t>::value) {
+        if (tryFromYaml(n["position"], *res.position)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.prefix)::value_t>::value) {
+        if (tryFromYaml(n["prefix"], *res.prefix)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.separate)::value_t>::value) {
+        if (tryFromYaml(n["separate"], *res.separate)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.itemSeparator)::value_t>::value) {
+        if (tryFromYaml(n["itemSeparator"], *res.itemSeparator)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.valueFrom)::value_t>::value) {
+        if (tryFromYaml(n["valueFrom"], *res.valueFrom)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.shellQuote)::value_t>::value) {
+        if (tryFromYaml(n["shellQuote"], *res.shellQuote)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandOutputBinding::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandOutputBinding");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::LoadContents::toYaml(config));
+    {
+         auto member = toYaml(*glob, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "glob", member);
+    }
+    {
+         auto member = toYaml(*outputEval, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "outputEval", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandOutputBinding::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::LoadContents::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["glob"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *glob);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputEval"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputEval);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputBinding>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputBinding> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandOutputBinding{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.glob)::value_t>::value) {
+        if (tryFromYaml(n["glob"], *res.glob)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputEval)::value_t>::value) {
+        if (tryFromYaml(n["outputEval"], *res.outputEval)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandLineBindable::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandLineBindable");
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandLineBindable::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineBindable>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineBindable> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandLineBindable{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandInputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandInputRecordField");
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*secondaryFiles, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "secondaryFiles", member);
+    }
+    {
+         auto member = toYaml(*streamable, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "streamable", member);
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    {
+         auto member = toYaml(*loadContents, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadContents", member);
+    }
+    {
+         auto member = toYaml(*loadListing, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "loadListing", member);
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandInputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *secondaryFiles);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["streamable"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *streamable);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadContents);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *loadListing);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputRecordField>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputRecordField> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandInputRecordField{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) {
+        if (tryFromYaml(n["secondaryFiles"], *res.secondaryFiles)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) {
+        if (tryFromYaml(n["streamable"], *res.streamable)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) {
+        if (tryFromYaml(n["format"], *res.format)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadContents)::value_t>::value) {
+        if (tryFromYaml(n["loadContents"], *res.loadContents)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadListing)::value_t>::value) {
+        if (tryFromYaml(n["loadListing"], *res.loadListing)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandInputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandInputRecordSchema");
+    }
+    {
+         auto member = toYaml(*fields, config);
+         member = convertListToMap(member, "name", "type", config);
+        addYamlField(n, "fields", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandInputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *fields);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputRecordSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputRecordSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandInputRecordSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) {
+        if (tryFromYaml(n["fields"], *res.fields)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandInputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandInputEnumSchema");
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*symbols, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "symbols", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandInputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["symbols"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *symbols);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputEnumSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputEnumSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandInputEnumSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.symbols)::value_t>::value) {
+        if (tryFromYaml(n["symbols"], *res.symbols)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandInputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandInputArraySchema");
+    }
+    {
+         auto member = toYaml(*items, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "items", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandInputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["items"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *items);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputArraySchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputArraySchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandInputArraySchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) {
+        if (tryFromYaml(n["items"], *res.items)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandOutputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandOutputRecordField");
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*secondaryFiles, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "secondaryFiles", member);
+    }
+    {
+         auto member = toYaml(*streamable, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "streamable", member);
+    }
+    {
+         auto member = toYaml(*format, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "format", member);
+    }
+    {
+         auto member = toYaml(*outputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "outputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandOutputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *secondaryFiles);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["streamable"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *streamable);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["format"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *format);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputRecordField>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputRecordField> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandOutputRecordField{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) {
+        if (tryFromYaml(n["secondaryFiles"], *res.secondaryFiles)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) {
+        if (tryFromYaml(n["streamable"], *res.streamable)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) {
+        if (tryFromYaml(n["format"], *res.format)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputBinding)::value_t>::value) {
+        if (tryFromYaml(n["outputBinding"], *res.outputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandOutputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandOutputRecordSchema");
+    }
+    {
+         auto member = toYaml(*fields, config);
+         member = convertListToMap(member, "name", "type", config);
+        addYamlField(n, "fields", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandOutputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *fields);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputRecordSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputRecordSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandOutputRecordSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) {
+        if (tryFromYaml(n["fields"], *res.fields)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandOutputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandOutputEnumSchema");
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    {
+         auto member = toYaml(*symbols, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "symbols", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandOutputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["symbols"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *symbols);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputEnumSchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputEnumSchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandOutputEnumSchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.symbols)::value_t>::value) {
+        if (tryFromYaml(n["symbols"], *res.symbols)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandOutputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandOutputArraySchema");
+    }
+    {
+         auto member = toYaml(*items, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "items", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*name, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "name", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandOutputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["items"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *items);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["name"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *name);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputArraySchema>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputArraySchema> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandOutputArraySchema{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) {
+        if (tryFromYaml(n["items"], *res.items)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) {
+        if (tryFromYaml(n["name"], *res.name)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandInputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandInputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::InputParameter::toYaml(config));
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandInputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::InputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandInputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandOutputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*outputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "outputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandOutputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputBinding)::value_t>::value) {
+        if (tryFromYaml(n["outputBinding"], *res.outputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::CommandLineTool::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("CommandLineTool");
+    }
+    {
+         auto member = toYaml(*id, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "id", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*inputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "inputs", member);
+    }
+    {
+         auto member = toYaml(*outputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "outputs", member);
+    }
+    {
+         auto member = toYaml(*requirements, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "requirements", member);
+    }
+    {
+         auto member = toYaml(*hints, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "hints", member);
+    }
+    {
+         auto member = toYaml(*cwlVersion, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "cwlVersion", member);
+    }
+    {
+         auto member = toYaml(*intent, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "intent", member);
+    }
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*baseCommand, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "baseCommand", member);
+    }
+    {
+         auto member = toYaml(*arguments, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "arguments", member);
+    }
+    {
+         auto member = toYaml(*stdin_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "stdin", member);
+    }
+    {
+         auto member = toYaml(*stderr_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "stderr", member);
+    }
+    {
+         auto member = toYaml(*stdout_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "stdout", member);
+    }
+    {
+         auto member = toYaml(*successCodes, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "successCodes", member);
+    }
+    {
+         auto member = toYaml(*temporaryFailCodes, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "temporaryFailCodes", member);
+    }
+    {
+         auto member = toYaml(*permanentFailCodes, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "permanentFailCodes", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::CommandLineTool::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["id"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *id);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *requirements);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["hints"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *hints);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *cwlVersion);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["intent"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *intent);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["baseCommand"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *baseCommand);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["arguments"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *arguments);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["stdin"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *stdin_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["stderr"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *stderr_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["stdout"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *stdout_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["successCodes"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *successCodes);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["temporaryFailCodes"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *temporaryFailCodes);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["permanentFailCodes"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *permanentFailCodes);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineTool>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineTool> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::CommandLineTool{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) {
+        if (tryFromYaml(n["id"], *res.id)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) {
+        if (tryFromYaml(n["inputs"], *res.inputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) {
+        if (tryFromYaml(n["outputs"], *res.outputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) {
+        if (tryFromYaml(n["requirements"], *res.requirements)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) {
+        if (tryFromYaml(n["hints"], *res.hints)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) {
+        if (tryFromYaml(n["cwlVersion"], *res.cwlVersion)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) {
+        if (tryFromYaml(n["intent"], *res.intent)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.baseCommand)::value_t>::value) {
+        if (tryFromYaml(n["baseCommand"], *res.baseCommand)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.arguments)::value_t>::value) {
+        if (tryFromYaml(n["arguments"], *res.arguments)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.stdin_)::value_t>::value) {
+        if (tryFromYaml(n["stdin"], *res.stdin_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.stderr_)::value_t>::value) {
+        if (tryFromYaml(n["stderr"], *res.stderr_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.stdout_)::value_t>::value) {
+        if (tryFromYaml(n["stdout"], *res.stdout_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.successCodes)::value_t>::value) {
+        if (tryFromYaml(n["successCodes"], *res.successCodes)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.temporaryFailCodes)::value_t>::value) {
+        if (tryFromYaml(n["temporaryFailCodes"], *res.temporaryFailCodes)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.permanentFailCodes)::value_t>::value) {
+        if (tryFromYaml(n["permanentFailCodes"], *res.permanentFailCodes)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::DockerRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("DockerRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*dockerPull, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dockerPull", member);
+    }
+    {
+         auto member = toYaml(*dockerLoad, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dockerLoad", member);
+    }
+    {
+         auto member = toYaml(*dockerFile, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dockerFile", member);
+    }
+    {
+         auto member = toYaml(*dockerImport, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dockerImport", member);
+    }
+    {
+         auto member = toYaml(*dockerImageId, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dockerImageId", member);
+    }
+    {
+         auto member = toYaml(*dockerOutputDirectory, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "dockerOutputDirectory", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::DockerRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dockerPull"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dockerPull);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dockerLoad"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dockerLoad);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dockerFile"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dockerFile);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dockerImport"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dockerImport);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dockerImageId"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dockerImageId);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["dockerOutputDirectory"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *dockerOutputDirectory);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::DockerRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::DockerRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::DockerRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerPull)::value_t>::value) {
+        if (tryFromYaml(n["dockerPull"], *res.dockerPull)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerLoad)::value_t>::value) {
+        if (tryFromYaml(n["dockerLoad"], *res.dockerLoad)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerFile)::value_t>::value) {
+        if (tryFromYaml(n["dockerFile"], *res.dockerFile)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerImport)::value_t>::value) {
+        if (tryFromYaml(n["dockerImport"], *res.dockerImport)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerImageId)::value_t>::value) {
+        if (tryFromYaml(n["dockerImageId"], *res.dockerImageId)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerOutputDirectory)::value_t>::value) {
+        if (tryFromYaml(n["dockerOutputDirectory"], *res.dockerOutputDirectory)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::SoftwareRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("SoftwareRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*packages, config);
+         member = convertListToMap(member, "package", "specs", config);
+        addYamlField(n, "packages", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::SoftwareRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["packages"], "package", "specs");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *packages);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SoftwareRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SoftwareRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::SoftwareRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.packages)::value_t>::value) {
+        if (tryFromYaml(n["packages"], *res.packages)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::SoftwarePackage::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("SoftwarePackage");
+    }
+    {
+         auto member = toYaml(*package, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "package", member);
+    }
+    {
+         auto member = toYaml(*version, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "version", member);
+    }
+    {
+         auto member = toYaml(*specs, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "specs", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::SoftwarePackage::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["package"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *package);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["version"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *version);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["specs"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *specs);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SoftwarePackage>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SoftwarePackage> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::SoftwarePackage{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.package)::value_t>::value) {
+        if (tryFromYaml(n["package"], *res.package)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.version)::value_t>::value) {
+        if (tryFromYaml(n["version"], *res.version)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.specs)::value_t>::value) {
+        if (tryFromYaml(n["specs"], *res.specs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Dirent::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Dirent");
+    }
+    {
+         auto member = toYaml(*entryname, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "entryname", member);
+    }
+    {
+         auto member = toYaml(*entry, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "entry", member);
+    }
+    {
+         auto member = toYaml(*writable, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "writable", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Dirent::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["entryname"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *entryname);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["entry"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *entry);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["writable"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *writable);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Dirent>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Dirent> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::Dirent{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.entryname)::value_t>::value) {
+        if (tryFromYaml(n["entryname"], *res.entryname)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.entry)::value_t>::value) {
+        if (tryFromYaml(n["entry"], *res.entry)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.writable)::value_t>::value) {
+        if (tryFromYaml(n["writable"], *res.writable)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InitialWorkDirRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InitialWorkDirRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*listing, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "listing", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InitialWorkDirRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["listing"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *listing);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InitialWorkDirRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InitialWorkDirRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InitialWorkDirRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.listing)::value_t>::value) {
+        if (tryFromYaml(n["listing"], *res.listing)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::EnvVarRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("EnvVarRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*envDef, config);
+         member = convertListToMap(member, "envName", "envValue", config);
+        addYamlField(n, "envDef", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::EnvVarRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["envDef"], "envName", "envValue");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *envDef);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::EnvVarRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::EnvVarRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::EnvVarRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.envDef)::value_t>::value) {
+        if (tryFromYaml(n["envDef"], *res.envDef)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ShellCommandRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ShellCommandRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ShellCommandRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ShellCommandRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ShellCommandRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::ShellCommandRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ResourceRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ResourceRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*coresMin, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "coresMin", member);
+    }
+    {
+         auto member = toYaml(*coresMax, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "coresMax", member);
+    }
+    {
+         auto member = toYaml(*ramMin, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "ramMin", member);
+    }
+    {
+         auto member = toYaml(*ramMax, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "ramMax", member);
+    }
+    {
+         auto member = toYaml(*tmpdirMin, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "tmpdirMin", member);
+    }
+    {
+         auto member = toYaml(*tmpdirMax, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "tmpdirMax", member);
+    }
+    {
+         auto member = toYaml(*outdirMin, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "outdirMin", member);
+    }
+    {
+         auto member = toYaml(*outdirMax, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "outdirMax", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ResourceRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["coresMin"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *coresMin);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["coresMax"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *coresMax);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["ramMin"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *ramMin);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["ramMax"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *ramMax);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["tmpdirMin"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *tmpdirMin);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["tmpdirMax"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *tmpdirMax);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outdirMin"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outdirMin);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outdirMax"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outdirMax);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ResourceRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ResourceRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::ResourceRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.coresMin)::value_t>::value) {
+        if (tryFromYaml(n["coresMin"], *res.coresMin)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.coresMax)::value_t>::value) {
+        if (tryFromYaml(n["coresMax"], *res.coresMax)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.ramMin)::value_t>::value) {
+        if (tryFromYaml(n["ramMin"], *res.ramMin)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.ramMax)::value_t>::value) {
+        if (tryFromYaml(n["ramMax"], *res.ramMax)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.tmpdirMin)::value_t>::value) {
+        if (tryFromYaml(n["tmpdirMin"], *res.tmpdirMin)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.tmpdirMax)::value_t>::value) {
+        if (tryFromYaml(n["tmpdirMax"], *res.tmpdirMax)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outdirMin)::value_t>::value) {
+        if (tryFromYaml(n["outdirMin"], *res.outdirMin)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outdirMax)::value_t>::value) {
+        if (tryFromYaml(n["outdirMax"], *res.outdirMax)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::WorkReuse::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("WorkReuse");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*enableReuse, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "enableReuse", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::WorkReuse::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["enableReuse"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *enableReuse);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkReuse>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkReuse> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::WorkReuse{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.enableReuse)::value_t>::value) {
+        if (tryFromYaml(n["enableReuse"], *res.enableReuse)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::NetworkAccess::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("NetworkAccess");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*networkAccess, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "networkAccess", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::NetworkAccess::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["networkAccess"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *networkAccess);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::NetworkAccess>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::NetworkAccess> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::NetworkAccess{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.networkAccess)::value_t>::value) {
+        if (tryFromYaml(n["networkAccess"], *res.networkAccess)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::InplaceUpdateRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("InplaceUpdateRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*inplaceUpdate, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inplaceUpdate", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::InplaceUpdateRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inplaceUpdate"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inplaceUpdate);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InplaceUpdateRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InplaceUpdateRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::InplaceUpdateRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inplaceUpdate)::value_t>::value) {
+        if (tryFromYaml(n["inplaceUpdate"], *res.inplaceUpdate)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ToolTimeLimit::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ToolTimeLimit");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*timelimit, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "timelimit", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ToolTimeLimit::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["timelimit"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *timelimit);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ToolTimeLimit>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ToolTimeLimit> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::ToolTimeLimit{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.timelimit)::value_t>::value) {
+        if (tryFromYaml(n["timelimit"], *res.timelimit)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ExpressionToolOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ExpressionToolOutputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ExpressionToolOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ExpressionToolOutputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ExpressionToolOutputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::ExpressionToolOutputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::WorkflowInputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("WorkflowInputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::InputParameter::toYaml(config));
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    {
+         auto member = toYaml(*inputBinding, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "inputBinding", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::WorkflowInputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::InputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputBinding);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowInputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowInputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::WorkflowInputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) {
+        if (tryFromYaml(n["inputBinding"], *res.inputBinding)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ExpressionTool::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ExpressionTool");
+    }
+    {
+         auto member = toYaml(*id, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "id", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*inputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "inputs", member);
+    }
+    {
+         auto member = toYaml(*outputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "outputs", member);
+    }
+    {
+         auto member = toYaml(*requirements, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "requirements", member);
+    }
+    {
+         auto member = toYaml(*hints, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "hints", member);
+    }
+    {
+         auto member = toYaml(*cwlVersion, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "cwlVersion", member);
+    }
+    {
+         auto member = toYaml(*intent, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "intent", member);
+    }
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*expression, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "expression", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ExpressionTool::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["id"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *id);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *requirements);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["hints"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *hints);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *cwlVersion);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["intent"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *intent);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["expression"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *expression);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ExpressionTool>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ExpressionTool> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::ExpressionTool{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) {
+        if (tryFromYaml(n["id"], *res.id)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) {
+        if (tryFromYaml(n["inputs"], *res.inputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) {
+        if (tryFromYaml(n["outputs"], *res.outputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) {
+        if (tryFromYaml(n["requirements"], *res.requirements)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) {
+        if (tryFromYaml(n["hints"], *res.hints)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) {
+        if (tryFromYaml(n["cwlVersion"], *res.cwlVersion)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) {
+        if (tryFromYaml(n["intent"], *res.intent)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.expression)::value_t>::value) {
+        if (tryFromYaml(n["expression"], *res.expression)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::WorkflowOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("WorkflowOutputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
+    {
+         auto member = toYaml(*outputSource, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "outputSource", member);
+    }
+    {
+         auto member = toYaml(*linkMerge, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "linkMerge", member);
+    }
+    {
+         auto member = toYaml(*pickValue, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "pickValue", member);
+    }
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::WorkflowOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["outputSource"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputSource);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["linkMerge"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *linkMerge);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["pickValue"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *pickValue);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowOutputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowOutputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::WorkflowOutputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputSource)::value_t>::value) {
+        if (tryFromYaml(n["outputSource"], *res.outputSource)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.linkMerge)::value_t>::value) {
+        if (tryFromYaml(n["linkMerge"], *res.linkMerge)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.pickValue)::value_t>::value) {
+        if (tryFromYaml(n["pickValue"], *res.pickValue)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE w3id_org::cwl::cwl::Sink::~Sink() = default;
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Sink::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Sink");
+    }
+    {
+         auto member = toYaml(*source, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "source", member);
+    }
+    {
+         auto member = toYaml(*linkMerge, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "linkMerge", member);
+    }
+    {
+         auto member = toYaml(*pickValue, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "pickValue", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Sink::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["source"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *source);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["linkMerge"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *linkMerge);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["pickValue"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *pickValue);
+    }
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::WorkflowStepInput::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("WorkflowStepInput");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::Sink::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::LoadContents::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
+    {
+         auto member = toYaml(*default_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "default", member);
+    }
+    {
+         auto member = toYaml(*valueFrom, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "valueFrom", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::WorkflowStepInput::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Identified::fromYaml(n);
+    w3id_org::cwl::cwl::Sink::fromYaml(n);
+    w3id_org::cwl::cwl::LoadContents::fromYaml(n);
+    w3id_org::cwl::cwl::Labeled::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["default"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *default_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["valueFrom"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *valueFrom);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStepInput>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStepInput> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::WorkflowStepInput{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.default_)::value_t>::value) {
+        if (tryFromYaml(n["default"], *res.default_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.valueFrom)::value_t>::value) {
+        if (tryFromYaml(n["valueFrom"], *res.valueFrom)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::WorkflowStepOutput::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("WorkflowStepOutput");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::WorkflowStepOutput::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Identified::fromYaml(n);
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStepOutput>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStepOutput> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::WorkflowStepOutput{};
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::WorkflowStep::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("WorkflowStep");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
+    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
+    {
+         auto member = toYaml(*in, config);
+         member = convertListToMap(member, "id", "source", config);
+        addYamlField(n, "in", member);
+    }
+    {
+         auto member = toYaml(*out, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "out", member);
+    }
+    {
+         auto member = toYaml(*requirements, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "requirements", member);
+    }
+    {
+         auto member = toYaml(*hints, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "hints", member);
+    }
+    {
+         auto member = toYaml(*run, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "run", member);
+    }
+    {
+         auto member = toYaml(*when, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "when", member);
+    }
+    {
+         auto member = toYaml(*scatter, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "scatter", member);
+    }
+    {
+         auto member = toYaml(*scatterMethod, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "scatterMethod", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::WorkflowStep::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::Identified::fromYaml(n);
+    w3id_org::cwl::cwl::Labeled::fromYaml(n);
+    w3id_org::cwl::salad::Documented::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["in"], "id", "source");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *in);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["out"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *out);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *requirements);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["hints"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *hints);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["run"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *run);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["when"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *when);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["scatter"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *scatter);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["scatterMethod"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *scatterMethod);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStep>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStep> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::WorkflowStep{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.in)::value_t>::value) {
+        if (tryFromYaml(n["in"], *res.in)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.out)::value_t>::value) {
+        if (tryFromYaml(n["out"], *res.out)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) {
+        if (tryFromYaml(n["requirements"], *res.requirements)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) {
+        if (tryFromYaml(n["hints"], *res.hints)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.run)::value_t>::value) {
+        if (tryFromYaml(n["run"], *res.run)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.when)::value_t>::value) {
+        if (tryFromYaml(n["when"], *res.when)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.scatter)::value_t>::value) {
+        if (tryFromYaml(n["scatter"], *res.scatter)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.scatterMethod)::value_t>::value) {
+        if (tryFromYaml(n["scatterMethod"], *res.scatterMethod)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Workflow::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Workflow");
+    }
+    {
+         auto member = toYaml(*id, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "id", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*inputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "inputs", member);
+    }
+    {
+         auto member = toYaml(*outputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "outputs", member);
+    }
+    {
+         auto member = toYaml(*requirements, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "requirements", member);
+    }
+    {
+         auto member = toYaml(*hints, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "hints", member);
+    }
+    {
+         auto member = toYaml(*cwlVersion, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "cwlVersion", member);
+    }
+    {
+         auto member = toYaml(*intent, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "intent", member);
+    }
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    {
+         auto member = toYaml(*steps, config);
+         member = convertListToMap(member, "id", "", config);
+        addYamlField(n, "steps", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Workflow::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["id"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *id);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *requirements);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["hints"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *hints);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *cwlVersion);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["intent"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *intent);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["steps"], "id", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *steps);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Workflow>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Workflow> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::Workflow{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) {
+        if (tryFromYaml(n["id"], *res.id)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) {
+        if (tryFromYaml(n["inputs"], *res.inputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) {
+        if (tryFromYaml(n["outputs"], *res.outputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) {
+        if (tryFromYaml(n["requirements"], *res.requirements)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) {
+        if (tryFromYaml(n["hints"], *res.hints)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) {
+        if (tryFromYaml(n["cwlVersion"], *res.cwlVersion)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) {
+        if (tryFromYaml(n["intent"], *res.intent)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.steps)::value_t>::value) {
+        if (tryFromYaml(n["steps"], *res.steps)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::SubworkflowFeatureRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("SubworkflowFeatureRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::SubworkflowFeatureRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SubworkflowFeatureRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SubworkflowFeatureRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::SubworkflowFeatureRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::ScatterFeatureRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("ScatterFeatureRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::ScatterFeatureRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ScatterFeatureRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ScatterFeatureRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::ScatterFeatureRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::MultipleInputFeatureRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("MultipleInputFeatureRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::MultipleInputFeatureRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::MultipleInputFeatureRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::MultipleInputFeatureRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::MultipleInputFeatureRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::StepInputExpressionRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("StepInputExpressionRequirement");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::StepInputExpressionRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::StepInputExpressionRequirement>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::StepInputExpressionRequirement> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::StepInputExpressionRequirement{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OperationInputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OperationInputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::InputParameter::toYaml(config));
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OperationInputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::InputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OperationInputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OperationInputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::OperationInputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::OperationOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("OperationOutputParameter");
+    }
+    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
+    {
+         auto member = toYaml(*type, config);
+         member = simplifyType(member, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "type", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::OperationOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
+    {
+        auto nodeAsList = convertMapToList(n["type"], "", "");
+        auto expandedNode = expandType(nodeAsList);
+        fromYaml(expandedNode, *type);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OperationOutputParameter>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OperationOutputParameter> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::OperationOutputParameter{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) {
+        if (tryFromYaml(n["type"], *res.type)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+TDL_CWL_INLINE auto w3id_org::cwl::cwl::Operation::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
+    using ::w3id_org::cwl::toYaml;
+    auto n = YAML::Node{};
+    if (config.generateTags) {
+        n.SetTag("Operation");
+    }
+    {
+         auto member = toYaml(*id, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "id", member);
+    }
+    {
+         auto member = toYaml(*label, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "label", member);
+    }
+    {
+         auto member = toYaml(*doc, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "doc", member);
+    }
+    {
+         auto member = toYaml(*inputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "inputs", member);
+    }
+    {
+         auto member = toYaml(*outputs, config);
+         member = convertListToMap(member, "id", "type", config);
+        addYamlField(n, "outputs", member);
+    }
+    {
+         auto member = toYaml(*requirements, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "requirements", member);
+    }
+    {
+         auto member = toYaml(*hints, config);
+         member = convertListToMap(member, "class", "", config);
+        addYamlField(n, "hints", member);
+    }
+    {
+         auto member = toYaml(*cwlVersion, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "cwlVersion", member);
+    }
+    {
+         auto member = toYaml(*intent, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "intent", member);
+    }
+    {
+         auto member = toYaml(*class_, config);
+         member = convertListToMap(member, "", "", config);
+        addYamlField(n, "class", member);
+    }
+    return n;
+}
+TDL_CWL_INLINE void w3id_org::cwl::cwl::Operation::fromYaml([[maybe_unused]] YAML::Node const& n) {
+    using ::w3id_org::cwl::fromYaml;
+    {
+        auto nodeAsList = convertMapToList(n["id"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *id);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["label"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *label);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["doc"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *doc);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *inputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *outputs);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *requirements);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["hints"], "class", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *hints);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *cwlVersion);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["intent"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *intent);
+    }
+    {
+        auto nodeAsList = convertMapToList(n["class"], "", "");
+        auto expandedNode = (nodeAsList);
+        fromYaml(expandedNode, *class_);
+    }
+}
+namespace w3id_org::cwl {
+TDL_CWL_INLINE auto DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Operation>::operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Operation> {
+    if (!n.IsDefined()) return std::nullopt;
+    if (!n.IsMap()) return std::nullopt;
+    auto res = ::w3id_org::cwl::cwl::Operation{};
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) {
+        if (tryFromYaml(n["id"], *res.id)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) {
+        if (tryFromYaml(n["label"], *res.label)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) {
+        if (tryFromYaml(n["doc"], *res.doc)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) {
+        if (tryFromYaml(n["inputs"], *res.inputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) {
+        if (tryFromYaml(n["outputs"], *res.outputs)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) {
+        if (tryFromYaml(n["requirements"], *res.requirements)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) {
+        if (tryFromYaml(n["hints"], *res.hints)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) {
+        if (tryFromYaml(n["cwlVersion"], *res.cwlVersion)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) {
+        if (tryFromYaml(n["intent"], *res.intent)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) {
+        if (tryFromYaml(n["class"], *res.class_)) try {
+            fromYaml(n, res);
+            return res;
+        } catch(...) {}
+    }
+
+    return std::nullopt;
+}
+}
+namespace w3id_org::cwl {
+
+TDL_CWL_INLINE auto load_document_from_yaml(YAML::Node n) -> DocumentRootType {
+    DocumentRootType root;
+    fromYaml(n, root);
+    return root;
+}
+TDL_CWL_INLINE auto load_document_from_string(std::string document) -> DocumentRootType {
+    return load_document_from_yaml(YAML::Load(document));
+}
+TDL_CWL_INLINE auto load_document(std::filesystem::path path) -> DocumentRootType {
+    return load_document_from_yaml(YAML::LoadFile(path.string()));
+}
+TDL_CWL_INLINE void store_document(DocumentRootType const& root, std::ostream& ostream, store_config config) {
+    auto y = toYaml(root, config);
+
+    YAML::Emitter out;
+    out << y;
+    ostream << out.c_str() << std::endl;
+}
+TDL_CWL_INLINE void store_document(DocumentRootType const& root, std::filesystem::path const& path, store_config config) {
+    auto ofs = std::ofstream{path};
+    store_document(root, ofs, config);
+}
+TDL_CWL_INLINE auto store_document_as_string(DocumentRootType const& root, store_config config) -> std::string {
+    auto ss = std::stringstream{};
+    store_document(root, ss, config);
+    return ss.str();
+}
+
+}
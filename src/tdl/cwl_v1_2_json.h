@@ -0,0 +1,1151 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <any>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "convertToString.h"
+#include "cwl_v1_2_stream.h"
+#include "jsonWriter.h"
+
+/* JSON documents of cwl_v1_2.h, without yaml-cpp
+ *
+ * A JSON text is parsed into the Tape of cwl_v1_2_stream.h, the structs are filled by the same readers as for
+ * YAML, so JSON reads exactly as load_document would read it. The structs are written event by event into a
+ * tdl::detail::JSONWriter, no YAML::Node is built.
+ */
+namespace w3id_org::cwl::stream {
+
+using JSONWriter = tdl::detail::JSONWriter;
+
+//!\brief appends a code point in UTF-8
+inline void appendUTF8(std::string & out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        out += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+/*!\brief parses a JSON text (RFC 8259) into `tape`
+ *
+ * Strings, numbers, `true` and `false` become scalars, `null` a null event. As in yaml-cpp, a quoted
+ * "1" and a 1 are the same scalar.
+ * \throws std::runtime_error if `text` is not a single valid JSON value
+ */
+class JSONReader {
+public:
+    JSONReader(std::string_view text, Tape & tape) : text{text}, tape{tape} {}
+
+    void read() {
+        skipSpace();
+        value();
+        while (!open.empty()) {
+            auto container = open.back();
+            auto isMap     = tape.events[container].kind == EventKind::Map;
+            skipSpace();
+            if (peek() == (isMap ? '}' : ']')) {
+                ++pos;
+                tape.endContainer(container);
+                open.pop_back();
+                continue;
+            }
+            // a container without events after its own has no entries yet
+            if (tape.events.size() > container + 1) {
+                expect(',');
+                skipSpace();
+            }
+            if (isMap) {
+                if (peek() != '"') {
+                    fail("expected a string as key");
+                }
+                tape.addScalar(string());
+                skipSpace();
+                expect(':');
+                skipSpace();
+            }
+            value();
+        }
+        skipSpace();
+        if (pos != text.size()) {
+            fail("unexpected characters after the value");
+        }
+    }
+
+private:
+    std::string_view    text;
+    Tape &              tape;
+    size_t              pos{};
+    std::vector<size_t> open{};    //!< the containers that are not closed yet
+    std::string         decoded{}; //!< buffer for strings with escape sequences
+
+    [[noreturn]] void fail(char const * message) const {
+        throw std::runtime_error{"invalid JSON (offset " + std::to_string(pos) + "): " + message};
+    }
+
+    auto peek() const -> char {
+        if (pos == text.size()) {
+            fail("unexpected end");
+        }
+        return text[pos];
+    }
+
+    void expect(char c) {
+        if (peek() != c) {
+            fail(c == ',' ? "expected ','" : "expected ':'");
+        }
+        ++pos;
+    }
+
+    void skipSpace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\n' || text[pos] == '\r' || text[pos] == '\t')) {
+            ++pos;
+        }
+    }
+
+    void literal(std::string_view word) {
+        if (text.substr(pos, word.size()) != word) {
+            fail("invalid literal");
+        }
+        pos += word.size();
+    }
+
+    //!\brief a scalar, or the start of a container
+    void value() {
+        switch (peek()) {
+        case '{': ++pos; open.push_back(tape.beginContainer(EventKind::Map)); return;
+        case '[': ++pos; open.push_back(tape.beginContainer(EventKind::Sequence)); return;
+        case '"': tape.addScalar(string()); return;
+        case 't': literal("true"); tape.addScalar("true"); return;
+        case 'f': literal("false"); tape.addScalar("false"); return;
+        case 'n': literal("null"); tape.addNull(); return;
+        default: break;
+        }
+        auto start = pos;
+        while (pos < text.size()
+               && ((text[pos] >= '0' && text[pos] <= '9') || text[pos] == '-' || text[pos] == '+' || text[pos] == '.'
+                   || text[pos] == 'e' || text[pos] == 'E')) {
+            ++pos;
+        }
+        auto number = text.substr(start, pos - start);
+        if (!tdl::detail::isJSONNumber(number)) {
+            pos = start;
+            fail("invalid value");
+        }
+        tape.addScalar(number);
+    }
+
+    auto hex4() -> uint32_t {
+        if (text.size() - pos < 4) {
+            fail("unexpected end");
+        }
+        auto value  = uint32_t{};
+        auto result = std::from_chars(text.data() + pos, text.data() + pos + 4, value, 16);
+        if (result.ptr != text.data() + pos + 4) {
+            fail("invalid \\u escape");
+        }
+        pos += 4;
+        return value;
+    }
+
+    //!\brief the content of a string, without escape sequences it is a view on `text`
+    auto string() -> std::string_view {
+        auto start = ++pos;
+        while (pos < text.size() && text[pos] != '"' && text[pos] != '\\') {
+            if (static_cast<unsigned char>(text[pos]) < 0x20) {
+                fail("control character in string");
+            }
+            ++pos;
+        }
+        if (peek() == '"') {
+            return text.substr(start, pos++ - start);
+        }
+
+        decoded.assign(text.data() + start, pos - start);
+        while (peek() != '"') {
+            auto c = text[pos++];
+            if (static_cast<unsigned char>(c) < 0x20) {
+                fail("control character in string");
+            }
+            if (c != '\\') {
+                decoded += c;
+                continue;
+            }
+            switch (peek()) {
+            case '"': decoded += '"'; break;
+            case '\\': decoded += '\\'; break;
+            case '/': decoded += '/'; break;
+            case 'b': decoded += '\b'; break;
+            case 'f': decoded += '\f'; break;
+            case 'n': decoded += '\n'; break;
+            case 'r': decoded += '\r'; break;
+            case 't': decoded += '\t'; break;
+            case 'u': {
+                ++pos;
+                auto codePoint = hex4();
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                    // a surrogate pair
+                    if (text.substr(pos, 2) != "\\u") {
+                        fail("unpaired surrogate");
+                    }
+                    pos += 2;
+                    auto low = hex4();
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        fail("unpaired surrogate");
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+                    fail("unpaired surrogate");
+                }
+                appendUTF8(decoded, codePoint);
+                continue;
+            }
+            default: fail("invalid escape sequence");
+            }
+            ++pos;
+        }
+        ++pos;
+        return decoded;
+    }
+};
+
+//!\brief false for values toYaml turns into an undefined node, these fields are not written
+inline auto isDefined(std::monostate const &) -> bool {
+    return false;
+}
+
+//!\brief only the types anyToYaml_impl knows are written
+inline auto isDefined(std::any const & value) -> bool {
+    auto const & type = value.type();
+    return type == typeid(bool) || type == typeid(float) || type == typeid(double) || type == typeid(char)
+           || type == typeid(int8_t) || type == typeid(uint8_t) || type == typeid(int16_t) || type == typeid(uint16_t)
+           || type == typeid(int32_t) || type == typeid(uint32_t) || type == typeid(int64_t)
+           || type == typeid(uint64_t) || type == typeid(std::string);
+}
+
+template <typename T>
+auto isDefined(T const &) -> bool {
+    return true;
+}
+
+template <typename... Args>
+auto isDefined(std::variant<Args...> const & value) -> bool {
+    return std::visit([](auto const & alternative) { return isDefined(alternative); }, value);
+}
+
+inline void write(JSONWriter & writer, std::monostate const &) {
+    writer.null();
+}
+
+inline void write(JSONWriter & writer, bool value) {
+    writer.scalar(value ? "true" : "false");
+}
+
+/*!\brief the shortest text that reads back as the same value, `.nan` and `.inf` are written as strings
+ *
+ * Uses floating point std::to_chars for floats if the standard library provides it, otherwise the float is
+ * formatted as double, which also reads back as the same float.
+ */
+template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+void writeNumber(JSONWriter & writer, T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(value)) {
+            writer.scalar(".nan");
+            return;
+        } else if (std::isinf(value)) {
+            writer.scalar(value > 0 ? ".inf" : "-.inf");
+            return;
+        }
+    }
+    if constexpr (std::is_same_v<T, float>) {
+#if defined(__cpp_lib_to_chars)
+        auto buffer = std::array<char, 32>{};
+        auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        writer.scalar({buffer.data(), static_cast<size_t>(result.ptr - buffer.data())});
+#else
+        writer.scalar(tdl::detail::formatNumber(static_cast<double>(value)).view());
+#endif
+    } else {
+        writer.scalar(tdl::detail::formatNumber(value).view());
+    }
+}
+
+inline void write(JSONWriter & writer, float value) {
+    writeNumber(writer, value);
+}
+
+inline void write(JSONWriter & writer, double value) {
+    writeNumber(writer, value);
+}
+
+inline void write(JSONWriter & writer, int32_t value) {
+    writeNumber(writer, value);
+}
+
+inline void write(JSONWriter & writer, int64_t value) {
+    writeNumber(writer, value);
+}
+
+inline void write(JSONWriter & writer, std::string const & value) {
+    writer.string(value);
+}
+
+inline void write(JSONWriter & writer, cwl_expression_string const & value) {
+    writer.string(value.s);
+}
+
+//!\brief like anyToYaml_impl, a char is a string of length one, other types are null
+inline void write(JSONWriter & writer, std::any const & value) {
+    if (auto v = std::any_cast<bool>(&value)) {
+        write(writer, *v);
+    } else if (auto v = std::any_cast<float>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<double>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<char>(&value)) {
+        writer.string({v, 1});
+    } else if (auto v = std::any_cast<int8_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<uint8_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<int16_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<uint16_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<int32_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<uint32_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<int64_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<uint64_t>(&value)) {
+        writeNumber(writer, *v);
+    } else if (auto v = std::any_cast<std::string>(&value)) {
+        writer.string(*v);
+    } else {
+        writer.null();
+    }
+}
+
+// forward declarations, the records refer to each other
+inline void writeFields(JSONWriter & writer, salad::Documented const & value);
+inline void writeFields(JSONWriter & writer, salad::RecordField const & value);
+inline void writeFields(JSONWriter & writer, salad::RecordSchema const & value);
+inline void writeFields(JSONWriter & writer, salad::EnumSchema const & value);
+inline void writeFields(JSONWriter & writer, salad::ArraySchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::File const & value);
+inline void writeFields(JSONWriter & writer, cwl::Directory const & value);
+inline void writeFields(JSONWriter & writer, cwl::Labeled const & value);
+inline void writeFields(JSONWriter & writer, cwl::Identified const & value);
+inline void writeFields(JSONWriter & writer, cwl::LoadContents const & value);
+inline void writeFields(JSONWriter & writer, cwl::FieldBase const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputFormat const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputFormat const & value);
+inline void writeFields(JSONWriter & writer, cwl::Parameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputBinding const & value);
+inline void writeFields(JSONWriter & writer, cwl::IOSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputRecordField const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputRecordSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputEnumSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputArraySchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputRecordField const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputRecordSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputEnumSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputArraySchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::InputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::OutputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::ProcessRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::Process const & value);
+inline void writeFields(JSONWriter & writer, cwl::InlineJavascriptRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandInputSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::SchemaDefRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::SecondaryFileSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::LoadListingRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::EnvironmentDef const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandLineBinding const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputBinding const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandLineBindable const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandInputRecordField const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandInputRecordSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandInputEnumSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandInputArraySchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputRecordField const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputRecordSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputEnumSchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputArraySchema const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandInputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::CommandLineTool const & value);
+inline void writeFields(JSONWriter & writer, cwl::DockerRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::SoftwareRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::SoftwarePackage const & value);
+inline void writeFields(JSONWriter & writer, cwl::Dirent const & value);
+inline void writeFields(JSONWriter & writer, cwl::InitialWorkDirRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::EnvVarRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::ShellCommandRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::ResourceRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::WorkReuse const & value);
+inline void writeFields(JSONWriter & writer, cwl::NetworkAccess const & value);
+inline void writeFields(JSONWriter & writer, cwl::InplaceUpdateRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::ToolTimeLimit const & value);
+inline void writeFields(JSONWriter & writer, cwl::ExpressionToolOutputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::WorkflowInputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::ExpressionTool const & value);
+inline void writeFields(JSONWriter & writer, cwl::WorkflowOutputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::Sink const & value);
+inline void writeFields(JSONWriter & writer, cwl::WorkflowStepInput const & value);
+inline void writeFields(JSONWriter & writer, cwl::WorkflowStepOutput const & value);
+inline void writeFields(JSONWriter & writer, cwl::WorkflowStep const & value);
+inline void writeFields(JSONWriter & writer, cwl::Workflow const & value);
+inline void writeFields(JSONWriter & writer, cwl::SubworkflowFeatureRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::ScatterFeatureRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::MultipleInputFeatureRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::StepInputExpressionRequirement const & value);
+inline void writeFields(JSONWriter & writer, cwl::OperationInputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::OperationOutputParameter const & value);
+inline void writeFields(JSONWriter & writer, cwl::Operation const & value);
+
+template <typename T>
+void write(JSONWriter & writer, std::vector<T> const & value);
+template <typename T>
+void write(JSONWriter & writer, std::map<std::string, T> const & value);
+template <typename... Args>
+void write(JSONWriter & writer, std::variant<Args...> const & value);
+template <typename T>
+void write(JSONWriter & writer, T const & value);
+
+//!\brief a field is written like addYamlField adds it, only if its value is defined
+template <typename T>
+void writeField(JSONWriter & writer, std::string_view key, T const & value) {
+    if (isDefined(value)) {
+        writer.key(key);
+        write(writer, value);
+    }
+}
+
+//!\brief a key that two bases write, mergeYaml keeps the position of the first and the defined value of the last
+template <typename T1, typename T2>
+void writeField(JSONWriter & writer, std::string_view key, T1 const & first, T2 const & second) {
+    if (isDefined(second)) {
+        writeField(writer, key, second);
+    } else {
+        writeField(writer, key, first);
+    }
+}
+
+// the records, generated by scripts/generate_cwl_records.py from the toYaml functions
+inline void writeFields(JSONWriter & writer, salad::Documented const & value) {
+    writeField(writer, "doc", *value.doc);
+}
+
+inline void writeFields(JSONWriter & writer, salad::RecordField const & value) {
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, salad::RecordSchema const & value) {
+    writeField(writer, "fields", *value.fields);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, salad::EnumSchema const & value) {
+    writeField(writer, "name", *value.name);
+    writeField(writer, "symbols", *value.symbols);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, salad::ArraySchema const & value) {
+    writeField(writer, "items", *value.items);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::File const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "location", *value.location);
+    writeField(writer, "path", *value.path);
+    writeField(writer, "basename", *value.basename);
+    writeField(writer, "dirname", *value.dirname);
+    writeField(writer, "nameroot", *value.nameroot);
+    writeField(writer, "nameext", *value.nameext);
+    writeField(writer, "checksum", *value.checksum);
+    writeField(writer, "size", *value.size);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "contents", *value.contents);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Directory const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "location", *value.location);
+    writeField(writer, "path", *value.path);
+    writeField(writer, "basename", *value.basename);
+    writeField(writer, "listing", *value.listing);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Labeled const & value) {
+    writeField(writer, "label", *value.label);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Identified const & value) {
+    writeField(writer, "id", *value.id);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::LoadContents const & value) {
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::FieldBase const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputFormat const & value) {
+    writeField(writer, "format", *value.format);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputFormat const & value) {
+    writeField(writer, "format", *value.format);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Parameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputBinding const & value) {
+    writeField(writer, "loadContents", *value.loadContents);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::IOSchema const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputSchema const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputSchema const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputRecordField const & value) {
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputRecordSchema const & value) {
+    writeField(writer, "fields", *value.fields);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputEnumSchema const & value) {
+    writeField(writer,
+               "name",
+               *static_cast<salad::EnumSchema const &>(value).name,
+               *static_cast<cwl::IOSchema const &>(value).name);
+    writeField(writer, "symbols", *value.symbols);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputArraySchema const & value) {
+    writeField(writer, "items", *value.items);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputRecordField const & value) {
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "format", *value.format);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputRecordSchema const & value) {
+    writeField(writer, "fields", *value.fields);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputEnumSchema const & value) {
+    writeField(writer,
+               "name",
+               *static_cast<salad::EnumSchema const &>(value).name,
+               *static_cast<cwl::IOSchema const &>(value).name);
+    writeField(writer, "symbols", *value.symbols);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputArraySchema const & value) {
+    writeField(writer, "items", *value.items);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "default", *value.default_);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OutputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+}
+
+inline void writeFields(JSONWriter &, cwl::ProcessRequirement const &) {}
+
+inline void writeFields(JSONWriter & writer, cwl::Process const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "inputs", *value.inputs);
+    writeField(writer, "outputs", *value.outputs);
+    writeField(writer, "requirements", *value.requirements);
+    writeField(writer, "hints", *value.hints);
+    writeField(writer, "cwlVersion", *value.cwlVersion);
+    writeField(writer, "intent", *value.intent);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InlineJavascriptRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "expressionLib", *value.expressionLib);
+}
+
+inline void writeFields(JSONWriter &, cwl::CommandInputSchema const &) {}
+
+inline void writeFields(JSONWriter & writer, cwl::SchemaDefRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "types", *value.types);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::SecondaryFileSchema const & value) {
+    writeField(writer, "pattern", *value.pattern);
+    writeField(writer, "required", *value.required);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::LoadListingRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "loadListing", *value.loadListing);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::EnvironmentDef const & value) {
+    writeField(writer, "envName", *value.envName);
+    writeField(writer, "envValue", *value.envValue);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandLineBinding const & value) {
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "position", *value.position);
+    writeField(writer, "prefix", *value.prefix);
+    writeField(writer, "separate", *value.separate);
+    writeField(writer, "itemSeparator", *value.itemSeparator);
+    writeField(writer, "valueFrom", *value.valueFrom);
+    writeField(writer, "shellQuote", *value.shellQuote);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputBinding const & value) {
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "glob", *value.glob);
+    writeField(writer, "outputEval", *value.outputEval);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandLineBindable const & value) {
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandInputRecordField const & value) {
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandInputRecordSchema const & value) {
+    writeField(writer, "fields", *value.fields);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandInputEnumSchema const & value) {
+    writeField(writer, "name", *value.name);
+    writeField(writer, "symbols", *value.symbols);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandInputArraySchema const & value) {
+    writeField(writer, "items", *value.items);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputRecordField const & value) {
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "outputBinding", *value.outputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputRecordSchema const & value) {
+    writeField(writer, "fields", *value.fields);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputEnumSchema const & value) {
+    writeField(writer, "name", *value.name);
+    writeField(writer, "symbols", *value.symbols);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputArraySchema const & value) {
+    writeField(writer, "items", *value.items);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "name", *value.name);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandInputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "default", *value.default_);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandOutputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "outputBinding", *value.outputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::CommandLineTool const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "inputs", *value.inputs);
+    writeField(writer, "outputs", *value.outputs);
+    writeField(writer, "requirements", *value.requirements);
+    writeField(writer, "hints", *value.hints);
+    writeField(writer, "cwlVersion", *value.cwlVersion);
+    writeField(writer, "intent", *value.intent);
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "baseCommand", *value.baseCommand);
+    writeField(writer, "arguments", *value.arguments);
+    writeField(writer, "stdin", *value.stdin_);
+    writeField(writer, "stderr", *value.stderr_);
+    writeField(writer, "stdout", *value.stdout_);
+    writeField(writer, "successCodes", *value.successCodes);
+    writeField(writer, "temporaryFailCodes", *value.temporaryFailCodes);
+    writeField(writer, "permanentFailCodes", *value.permanentFailCodes);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::DockerRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "dockerPull", *value.dockerPull);
+    writeField(writer, "dockerLoad", *value.dockerLoad);
+    writeField(writer, "dockerFile", *value.dockerFile);
+    writeField(writer, "dockerImport", *value.dockerImport);
+    writeField(writer, "dockerImageId", *value.dockerImageId);
+    writeField(writer, "dockerOutputDirectory", *value.dockerOutputDirectory);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::SoftwareRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "packages", *value.packages);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::SoftwarePackage const & value) {
+    writeField(writer, "package", *value.package);
+    writeField(writer, "version", *value.version);
+    writeField(writer, "specs", *value.specs);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Dirent const & value) {
+    writeField(writer, "entryname", *value.entryname);
+    writeField(writer, "entry", *value.entry);
+    writeField(writer, "writable", *value.writable);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InitialWorkDirRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "listing", *value.listing);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::EnvVarRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "envDef", *value.envDef);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::ShellCommandRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::ResourceRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "coresMin", *value.coresMin);
+    writeField(writer, "coresMax", *value.coresMax);
+    writeField(writer, "ramMin", *value.ramMin);
+    writeField(writer, "ramMax", *value.ramMax);
+    writeField(writer, "tmpdirMin", *value.tmpdirMin);
+    writeField(writer, "tmpdirMax", *value.tmpdirMax);
+    writeField(writer, "outdirMin", *value.outdirMin);
+    writeField(writer, "outdirMax", *value.outdirMax);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::WorkReuse const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "enableReuse", *value.enableReuse);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::NetworkAccess const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "networkAccess", *value.networkAccess);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::InplaceUpdateRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "inplaceUpdate", *value.inplaceUpdate);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::ToolTimeLimit const & value) {
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "timelimit", *value.timelimit);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::ExpressionToolOutputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::WorkflowInputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "default", *value.default_);
+    writeField(writer, "type", *value.type);
+    writeField(writer, "inputBinding", *value.inputBinding);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::ExpressionTool const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "inputs", *value.inputs);
+    writeField(writer, "outputs", *value.outputs);
+    writeField(writer, "requirements", *value.requirements);
+    writeField(writer, "hints", *value.hints);
+    writeField(writer, "cwlVersion", *value.cwlVersion);
+    writeField(writer, "intent", *value.intent);
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "expression", *value.expression);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::WorkflowOutputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "outputSource", *value.outputSource);
+    writeField(writer, "linkMerge", *value.linkMerge);
+    writeField(writer, "pickValue", *value.pickValue);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Sink const & value) {
+    writeField(writer, "source", *value.source);
+    writeField(writer, "linkMerge", *value.linkMerge);
+    writeField(writer, "pickValue", *value.pickValue);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::WorkflowStepInput const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "source", *value.source);
+    writeField(writer, "linkMerge", *value.linkMerge);
+    writeField(writer, "pickValue", *value.pickValue);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "default", *value.default_);
+    writeField(writer, "valueFrom", *value.valueFrom);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::WorkflowStepOutput const & value) {
+    writeField(writer, "id", *value.id);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::WorkflowStep const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "in", *value.in);
+    writeField(writer, "out", *value.out);
+    writeField(writer, "requirements", *value.requirements);
+    writeField(writer, "hints", *value.hints);
+    writeField(writer, "run", *value.run);
+    writeField(writer, "when", *value.when);
+    writeField(writer, "scatter", *value.scatter);
+    writeField(writer, "scatterMethod", *value.scatterMethod);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Workflow const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "inputs", *value.inputs);
+    writeField(writer, "outputs", *value.outputs);
+    writeField(writer, "requirements", *value.requirements);
+    writeField(writer, "hints", *value.hints);
+    writeField(writer, "cwlVersion", *value.cwlVersion);
+    writeField(writer, "intent", *value.intent);
+    writeField(writer, "class", *value.class_);
+    writeField(writer, "steps", *value.steps);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::SubworkflowFeatureRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::ScatterFeatureRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::MultipleInputFeatureRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::StepInputExpressionRequirement const & value) {
+    writeField(writer, "class", *value.class_);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OperationInputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "loadContents", *value.loadContents);
+    writeField(writer, "loadListing", *value.loadListing);
+    writeField(writer, "default", *value.default_);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::OperationOutputParameter const & value) {
+    writeField(writer, "label", *value.label);
+    writeField(writer, "secondaryFiles", *value.secondaryFiles);
+    writeField(writer, "streamable", *value.streamable);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "id", *value.id);
+    writeField(writer, "format", *value.format);
+    writeField(writer, "type", *value.type);
+}
+
+inline void writeFields(JSONWriter & writer, cwl::Operation const & value) {
+    writeField(writer, "id", *value.id);
+    writeField(writer, "label", *value.label);
+    writeField(writer, "doc", *value.doc);
+    writeField(writer, "inputs", *value.inputs);
+    writeField(writer, "outputs", *value.outputs);
+    writeField(writer, "requirements", *value.requirements);
+    writeField(writer, "hints", *value.hints);
+    writeField(writer, "cwlVersion", *value.cwlVersion);
+    writeField(writer, "intent", *value.intent);
+    writeField(writer, "class", *value.class_);
+}
+
+// end of the generated records
+
+template <typename T>
+void write(JSONWriter & writer, std::vector<T> const & value) {
+    writer.beginSeq();
+    for (auto const & element : value) {
+        if (isDefined(element)) {
+            write(writer, element);
+        } else {
+            writer.null();
+        }
+    }
+    writer.endSeq();
+}
+
+template <typename T>
+void write(JSONWriter & writer, std::map<std::string, T> const & value) {
+    writer.beginMap();
+    for (auto const & [key, element] : value) {
+        writer.key(key);
+        if (isDefined(element)) {
+            write(writer, element);
+        } else {
+            writer.null();
+        }
+    }
+    writer.endMap();
+}
+
+template <typename... Args>
+void write(JSONWriter & writer, std::variant<Args...> const & value) {
+    std::visit([&](auto const & alternative) { write(writer, alternative); }, value);
+}
+
+//!\brief enums and records
+template <typename T>
+void write(JSONWriter & writer, T const & value) {
+    if constexpr (std::is_enum_v<T>) {
+        writer.string(to_string(value));
+    } else {
+        writer.beginMap();
+        writeFields(writer, value);
+        writer.endMap();
+    }
+}
+
+} // namespace w3id_org::cwl::stream
+
+namespace w3id_org::cwl {
+
+/*!\brief loads a process from a JSON document, as load_document_from_string would load it
+ *
+ * The text is parsed by stream::JSONReader, neither yaml-cpp's parser nor a YAML::Node graph is involved.
+ * \throws std::runtime_error if the text is no valid JSON or the process matches no DocumentRootType alternative
+ */
+inline auto load_document_from_json(std::string_view document) -> DocumentRootType {
+    auto tape = stream::Tape{};
+    stream::JSONReader{document, tape}.read();
+    auto root = DocumentRootType{};
+    if (!stream::read(stream::NodeRef::event(tape, 0), root)) {
+        throw std::runtime_error{"didn't find any overload"};
+    }
+    return root;
+}
+
+/*!\brief writes a process as compact JSON
+ *
+ * The fields are those store_document writes, in the same order. Lists stay lists and types are written
+ * expanded, like store_document with `simplifyTypes` and `transformListsToMaps` disabled.
+ */
+inline auto store_document_as_json(DocumentRootType const & root) -> std::string {
+    auto out    = std::string{};
+    auto writer = stream::JSONWriter{out};
+    stream::write(writer, root);
+    return out;
+}
+
+} // namespace w3id_org::cwl
@@ -0,0 +1,1842 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
+#include <yaml-cpp/yaml.h>
+
+#include "cwl_v1_2.h"
+
+/* An event based loader for the documents of cwl_v1_2.h
+ *
+ * load_document() builds the complete yaml-cpp node graph first, the generated fromYaml functions then search
+ * it and copy parts of it (convertMapToList, expandType). Here the events of yaml-cpp's parser are recorded
+ * into a Tape, two flat buffers without an allocation per node, and the structs are filled directly from it
+ * in one pass. Map shaped lists and the type DSL are views on the Tape, nothing is copied.
+ *
+ * The readers follow the generated fromYaml functions field by field (the per record functions at the end
+ * are generated from them), so both loaders produce the same structs. Instead of throwing they return false.
+ * One difference: an alias reads the anchored node as written. In a yaml-cpp graph it also shows the keys
+ * convertMapToList added to the anchored node.
+ *
+ * The processes of a packed document (`$graph`) are read as soon as their last event arrives, afterwards
+ * their events are dropped. A packed document is never held in memory completely.
+ */
+namespace w3id_org::cwl::stream {
+
+//!\brief kinds of recorded parser events
+enum class EventKind : uint8_t {
+    Null,
+    Scalar,
+    Sequence,
+    Map,
+    Alias,
+};
+
+//!\brief a recorded parser event, containers know their end, so they are skipped in O(1)
+struct Event {
+    EventKind kind{};
+    size_t    end{};    //!< Sequence/Map: index behind their last event, Alias: index of the anchored event
+    size_t    offset{}; //!< Scalar: position of the value in Tape::text
+    size_t    size{};   //!< Scalar: length of the value
+};
+
+//!\brief the events of a document in order, the values of all scalars are stored back to back in `text`
+struct Tape {
+    std::vector<Event> events{};
+    std::string        text{};
+
+    auto addNull() -> size_t {
+        events.push_back({EventKind::Null, 0, 0, 0});
+        return events.size() - 1;
+    }
+
+    auto addScalar(std::string_view value) -> size_t {
+        events.push_back({EventKind::Scalar, 0, text.size(), value.size()});
+        text += value;
+        return events.size() - 1;
+    }
+
+    auto addAlias(size_t target) -> size_t {
+        events.push_back({EventKind::Alias, target, 0, 0});
+        return events.size() - 1;
+    }
+
+    auto beginContainer(EventKind kind) -> size_t {
+        events.push_back({kind, 0, 0, 0});
+        return events.size() - 1;
+    }
+
+    void endContainer(size_t index) {
+        events[index].end = events.size();
+    }
+
+    //!\brief index behind the event at `index` and everything it contains
+    auto next(size_t index) const -> size_t {
+        auto kind = events[index].kind;
+        return (kind == EventKind::Sequence || kind == EventKind::Map) ? events[index].end : index + 1;
+    }
+
+    //!\brief follows aliases to the anchored event
+    auto resolve(size_t index) const -> size_t {
+        while (events[index].kind == EventKind::Alias) {
+            index = events[index].end;
+        }
+        return index;
+    }
+
+    //!\brief value of a scalar, only valid until the next scalar is added
+    auto scalar(size_t index) const -> std::string_view {
+        return {text.data() + events[index].offset, events[index].size};
+    }
+};
+
+//!\brief node types as yaml-cpp reports them, Undefined is a missing node
+enum class NodeType : uint8_t {
+    Undefined,
+    Null,
+    Scalar,
+    Sequence,
+    Map,
+};
+
+/*!\brief a node as the generated fromYaml functions see it
+ *
+ * Besides the nodes on a Tape, this is the list convertMapToList makes out of a map, and the elements of
+ * that list. An element is the value of an entry with the key added as `subject`, or, if the value is not a
+ * map and there is a `predicate`, the map `{subject: key, predicate: value}`.
+ */
+class NodeRef {
+public:
+    NodeRef() = default;
+
+    static auto event(Tape & tape, size_t index) -> NodeRef {
+        auto node  = NodeRef{};
+        node.tape  = &tape;
+        node.kind  = Kind::Event;
+        node.index = tape.resolve(index);
+        return node;
+    }
+
+    /*!\brief like convertMapToList, `node` is unchanged if it is not a map or there is no subject
+     *
+     * Fails where convertMapToList throws, an entry with a scalar value can not get a subject.
+     */
+    static auto mapToList(NodeRef const & node, std::string_view subject, std::string_view predicate, NodeRef & out)
+        -> bool {
+        if (subject.empty() || node.kind != Kind::Event || node.type() != NodeType::Map) {
+            out = node;
+            return true;
+        }
+        auto & tape = *node.tape;
+        for (auto i = node.index + 1; i < tape.events[node.index].end; i = tape.next(tape.next(i))) {
+            if (predicate.empty() && tape.events[tape.resolve(tape.next(i))].kind == EventKind::Scalar) {
+                return false;
+            }
+        }
+        out           = node;
+        out.kind      = Kind::MapAsList;
+        out.subject   = subject;
+        out.predicate = predicate;
+        return true;
+    }
+
+    auto type() const -> NodeType {
+        switch (kind) {
+        case Kind::Undefined: return NodeType::Undefined;
+        case Kind::Element: return NodeType::Map;
+        case Kind::MapAsList:
+            // an empty map becomes an empty, null node
+            return tape->events[index].end > index + 1 ? NodeType::Sequence : NodeType::Null;
+        case Kind::Event: break;
+        }
+        switch (tape->events[index].kind) {
+        case EventKind::Null: return NodeType::Null;
+        case EventKind::Scalar: return NodeType::Scalar;
+        case EventKind::Sequence: return NodeType::Sequence;
+        default: return NodeType::Map;
+        }
+    }
+
+    //!\brief value of a scalar, only valid until the tape grows
+    auto scalar() const -> std::string_view {
+        return tape->scalar(index);
+    }
+
+    auto getTape() const -> Tape * {
+        return tape;
+    }
+
+    /*!\brief the value of `key` or an undefined node
+     *
+     * Fails where yaml-cpp throws: on undefined nodes and on scalars.
+     */
+    auto lookup(std::string_view key, NodeRef & value) const -> bool {
+        value = NodeRef{};
+        switch (kind) {
+        case Kind::Undefined: return false;
+        case Kind::MapAsList: return true;
+        case Kind::Element: return lookupElement(key, value);
+        case Kind::Event: break;
+        }
+        switch (tape->events[index].kind) {
+        case EventKind::Scalar: return false;
+        case EventKind::Map: value = lookupMap(index, key); return true;
+        default: return true;
+        }
+    }
+
+    //!\brief calls `f` with each element of a sequence, stops when `f` returns false
+    template <typename F>
+    auto forEachElement(F && f) const -> bool {
+        if (kind == Kind::Event) {
+            for (auto i = index + 1; i < tape->events[index].end; i = tape->next(i)) {
+                if (!f(event(*tape, i))) {
+                    return false;
+                }
+            }
+        } else if (kind == Kind::MapAsList) {
+            for (auto i = index + 1; i < tape->events[index].end; i = tape->next(tape->next(i))) {
+                auto element      = NodeRef{};
+                element.tape      = tape;
+                element.kind      = Kind::Element;
+                element.index     = tape->resolve(tape->next(i));
+                element.keyIndex  = tape->resolve(i);
+                element.subject   = subject;
+                element.predicate = predicate;
+                if (!f(element)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    enum class Kind : uint8_t {
+        Undefined,
+        Event,
+        MapAsList,
+        Element,
+    };
+
+    Tape *           tape{};
+    Kind             kind{Kind::Undefined};
+    size_t           index{};    //!< Event/MapAsList: the (resolved) event, Element: the value
+    size_t           keyIndex{}; //!< Element: the key
+    std::string_view subject{};
+    std::string_view predicate{};
+
+    //!\brief the first entry with a scalar key equal to `key`, like yaml-cpp
+    auto lookupMap(size_t map, std::string_view key) const -> NodeRef {
+        for (auto i = map + 1; i < tape->events[map].end; i = tape->next(tape->next(i))) {
+            auto keyEvent = tape->resolve(i);
+            if (tape->events[keyEvent].kind == EventKind::Scalar && tape->scalar(keyEvent) == key) {
+                return event(*tape, tape->next(i));
+            }
+        }
+        return NodeRef{};
+    }
+
+    auto lookupElement(std::string_view key, NodeRef & value) const -> bool {
+        if (key == subject) {
+            value = event(*tape, keyIndex);
+            return true;
+        }
+        auto valueKind = tape->events[index].kind;
+        if (!predicate.empty() && valueKind != EventKind::Map) {
+            if (key == predicate) {
+                value = event(*tape, index);
+            }
+            return true;
+        }
+        if (valueKind == EventKind::Map) {
+            value = lookupMap(index, key);
+        } else if (valueKind == EventKind::Sequence) {
+            // yaml-cpp turned the sequence into a map, the keys are the positions
+            if (key.empty() || (key.size() > 1 && key[0] == '0')) {
+                return true;
+            }
+            auto position = size_t{0};
+            for (auto c : key) {
+                if (c < '0' || c > '9') {
+                    return true;
+                }
+                position = position * 10 + static_cast<size_t>(c - '0');
+            }
+            auto i = index + 1;
+            for (; i < tape->events[index].end && position > 0; i = tape->next(i)) {
+                --position;
+            }
+            if (i < tape->events[index].end) {
+                value = event(*tape, i);
+            }
+        }
+        return true;
+    }
+};
+
+//!\brief writes the expansion of a type DSL string (`File[]?`) to the tape, like expandType
+inline auto appendType(Tape & tape, std::string_view type) -> size_t {
+    auto endsWith = [&](std::string_view suffix) {
+        return type.size() >= suffix.size() && type.substr(type.size() - suffix.size()) == suffix;
+    };
+    auto appendArray = [&](std::string_view items) {
+        auto array = tape.beginContainer(EventKind::Map);
+        tape.addScalar("type");
+        tape.addScalar("array");
+        tape.addScalar("items");
+        appendType(tape, items);
+        tape.endContainer(array);
+        return array;
+    };
+
+    if (endsWith("[]?")) {
+        auto list = tape.beginContainer(EventKind::Sequence);
+        tape.addScalar("null");
+        appendArray(type.substr(0, type.size() - 3));
+        tape.endContainer(list);
+        return list;
+    }
+    if (endsWith("[]")) {
+        return appendArray(type.substr(0, type.size() - 2));
+    }
+    if (endsWith("?")) {
+        auto list = tape.beginContainer(EventKind::Sequence);
+        tape.addScalar("null");
+        appendType(tape, type.substr(0, type.size() - 1));
+        tape.endContainer(list);
+        return list;
+    }
+    return tape.addScalar(type);
+}
+
+//!\brief like expandType, the expansion is appended to the tape of `node`
+inline auto expandType(NodeRef const & node) -> NodeRef {
+    if (node.type() != NodeType::Scalar) {
+        return node;
+    }
+    // a copy, the scalar moves when the tape grows
+    auto type = std::string{node.scalar()};
+    if (type.empty() || (type.back() != '?' && type.back() != ']')) {
+        return node;
+    }
+    auto & tape = *node.getTape();
+    return NodeRef::event(tape, appendType(tape, type));
+}
+
+// scalars, decoded by YAML::convert like Node::as does
+template <typename T>
+auto readScalar(NodeRef const & node, T & out) -> bool {
+    return node.type() == NodeType::Scalar && YAML::convert<T>::decode(YAML::Node{std::string{node.scalar()}}, out);
+}
+
+inline auto read(NodeRef const & node, bool & out) -> bool {
+    return readScalar(node, out);
+}
+
+inline auto read(NodeRef const & node, float & out) -> bool {
+    return readScalar(node, out);
+}
+
+inline auto read(NodeRef const & node, double & out) -> bool {
+    return readScalar(node, out);
+}
+
+inline auto read(NodeRef const & node, int32_t & out) -> bool {
+    return readScalar(node, out);
+}
+
+inline auto read(NodeRef const & node, int64_t & out) -> bool {
+    return readScalar(node, out);
+}
+
+//!\brief like Node::as<std::string>, a null node reads as "null"
+inline auto read(NodeRef const & node, std::string & out) -> bool {
+    switch (node.type()) {
+    case NodeType::Scalar: out = node.scalar(); return true;
+    case NodeType::Null: out = "null"; return true;
+    default: return false;
+    }
+}
+
+inline auto read(NodeRef const &, std::any &) -> bool {
+    return true;
+}
+
+inline auto read(NodeRef const &, std::monostate &) -> bool {
+    return true;
+}
+
+inline auto read(NodeRef const & node, cwl_expression_string & out) -> bool {
+    return read(node, out.s);
+}
+
+//!\brief reads the value of `key` into a field, `subject` and `predicate` as for convertMapToList
+template <typename T>
+auto readField(NodeRef const & node,
+               std::string_view key,
+               std::string_view subject,
+               std::string_view predicate,
+               bool typeDSL,
+               T & out) -> bool {
+    auto value = NodeRef{};
+    if (!node.lookup(key, value) || !NodeRef::mapToList(value, subject, predicate, value)) {
+        return false;
+    }
+    return read(typeDSL ? expandType(value) : value, out);
+}
+
+//!\brief checks a constant field (an enum) without reading anything else
+template <typename T>
+auto readConstant(NodeRef const & node, std::string_view key, T & out) -> bool {
+    auto value = NodeRef{};
+    return node.lookup(key, value) && value.type() == NodeType::Scalar && try_to_enum(value.scalar(), out);
+}
+
+// forward declarations, the records refer to each other
+inline auto readFields(NodeRef const & n, salad::Documented & out) -> bool;
+inline auto readFields(NodeRef const & n, salad::RecordField & out) -> bool;
+inline auto readFields(NodeRef const & n, salad::RecordSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, salad::EnumSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, salad::ArraySchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::File & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Directory & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Labeled & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Identified & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::LoadContents & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::FieldBase & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputFormat & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputFormat & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Parameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputBinding & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::IOSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputRecordField & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputRecordSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputEnumSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputArraySchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputRecordField & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputRecordSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputEnumSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputArraySchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OutputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ProcessRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Process & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InlineJavascriptRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandInputSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::SchemaDefRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::SecondaryFileSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::LoadListingRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::EnvironmentDef & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandLineBinding & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandOutputBinding & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandLineBindable & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandInputRecordField & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandInputRecordSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandInputEnumSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandInputArraySchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandOutputRecordField & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandOutputRecordSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandOutputEnumSchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandOutputArraySchema & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandInputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandOutputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::CommandLineTool & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::DockerRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::SoftwareRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::SoftwarePackage & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Dirent & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InitialWorkDirRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::EnvVarRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ShellCommandRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ResourceRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::WorkReuse & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::NetworkAccess & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::InplaceUpdateRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ToolTimeLimit & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ExpressionToolOutputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::WorkflowInputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ExpressionTool & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::WorkflowOutputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Sink & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::WorkflowStepInput & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::WorkflowStepOutput & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::WorkflowStep & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Workflow & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::SubworkflowFeatureRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::ScatterFeatureRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::MultipleInputFeatureRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::StepInputExpressionRequirement & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OperationInputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::OperationOutputParameter & out) -> bool;
+inline auto readFields(NodeRef const & n, cwl::Operation & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<salad::RecordSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<salad::EnumSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<salad::ArraySchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::File> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::Directory> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::InputRecordSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::InputArraySchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::OutputRecordSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::OutputArraySchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::InlineJavascriptRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::SchemaDefRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::LoadListingRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandInputRecordSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandInputEnumSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandInputArraySchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandOutputRecordSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandOutputEnumSchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandOutputArraySchema> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandLineTool> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::DockerRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::SoftwareRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::InitialWorkDirRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::EnvVarRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::ShellCommandRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::ResourceRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::WorkReuse> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::NetworkAccess> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::InplaceUpdateRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::ToolTimeLimit> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::ExpressionTool> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::Workflow> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::SubworkflowFeatureRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::ScatterFeatureRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::MultipleInputFeatureRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::StepInputExpressionRequirement> & out) -> bool;
+inline auto detect(NodeRef const & n, std::optional<cwl::Operation> & out) -> bool;
+
+template <typename T>
+auto read(NodeRef const & node, std::vector<T> & out) -> bool;
+template <typename... Args>
+auto read(NodeRef const & node, std::variant<Args...> & out) -> bool;
+template <typename T>
+auto read(NodeRef const & node, T & out) -> bool;
+
+/*!\brief detects which alternative of a variant a node is, like DetectAndExtractFromYaml
+ *
+ * Returns false where reading a detected alternative failed, `out` stays empty if it is not this alternative.
+ * Enums, expressions and std::any are never detected.
+ */
+template <typename T>
+auto detect(NodeRef const &, std::optional<T> &) -> bool {
+    return true;
+}
+
+inline auto detect(NodeRef const & node, std::optional<std::monostate> & out) -> bool {
+    if (node.type() == NodeType::Undefined) {
+        out = std::monostate{};
+    }
+    return true;
+}
+
+template <typename S>
+auto detectScalar(NodeRef const & node, std::optional<S> & out) -> bool {
+    auto value = S{};
+    if (readScalar(node, value)) {
+        out = std::move(value);
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & node, std::optional<bool> & out) -> bool {
+    return detectScalar(node, out);
+}
+
+inline auto detect(NodeRef const & node, std::optional<float> & out) -> bool {
+    return detectScalar(node, out);
+}
+
+inline auto detect(NodeRef const & node, std::optional<double> & out) -> bool {
+    return detectScalar(node, out);
+}
+
+inline auto detect(NodeRef const & node, std::optional<int32_t> & out) -> bool {
+    return detectScalar(node, out);
+}
+
+inline auto detect(NodeRef const & node, std::optional<int64_t> & out) -> bool {
+    return detectScalar(node, out);
+}
+
+inline auto detect(NodeRef const & node, std::optional<std::string> & out) -> bool {
+    if (node.type() == NodeType::Scalar) {
+        out = std::string{node.scalar()};
+    }
+    return true;
+}
+
+template <typename T>
+auto detect(NodeRef const & node, std::optional<std::vector<T>> & out) -> bool {
+    if (node.type() != NodeType::Sequence) {
+        return true;
+    }
+    auto res = std::vector<T>{};
+    if (!read(node, res)) {
+        return false;
+    }
+    out = std::move(res);
+    return true;
+}
+
+// the records, generated by scripts/generate_cwl_records.py from the fromYaml functions
+inline auto readFields(NodeRef const & n, salad::Documented & out) -> bool {
+    return readField(n, "doc", "", "", false, *out.doc);
+}
+
+inline auto readFields(NodeRef const & n, salad::RecordField & out) -> bool {
+    return readFields(n, static_cast<salad::Documented &>(out))
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, salad::RecordSchema & out) -> bool {
+    return readField(n, "fields", "name", "type", false, *out.fields)
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, salad::EnumSchema & out) -> bool {
+    return readField(n, "name", "", "", false, *out.name)
+           && readField(n, "symbols", "", "", false, *out.symbols)
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, salad::ArraySchema & out) -> bool {
+    return readField(n, "items", "", "", false, *out.items)
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, cwl::File & out) -> bool {
+    return readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "location", "", "", false, *out.location)
+           && readField(n, "path", "", "", false, *out.path)
+           && readField(n, "basename", "", "", false, *out.basename)
+           && readField(n, "dirname", "", "", false, *out.dirname)
+           && readField(n, "nameroot", "", "", false, *out.nameroot)
+           && readField(n, "nameext", "", "", false, *out.nameext)
+           && readField(n, "checksum", "", "", false, *out.checksum)
+           && readField(n, "size", "", "", false, *out.size)
+           && readField(n, "secondaryFiles", "", "", false, *out.secondaryFiles)
+           && readField(n, "format", "", "", false, *out.format)
+           && readField(n, "contents", "", "", false, *out.contents);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Directory & out) -> bool {
+    return readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "location", "", "", false, *out.location)
+           && readField(n, "path", "", "", false, *out.path)
+           && readField(n, "basename", "", "", false, *out.basename)
+           && readField(n, "listing", "", "", false, *out.listing);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Labeled & out) -> bool {
+    return readField(n, "label", "", "", false, *out.label);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Identified & out) -> bool {
+    return readField(n, "id", "", "", false, *out.id);
+}
+
+inline auto readFields(NodeRef const & n, cwl::LoadContents & out) -> bool {
+    return readField(n, "loadContents", "", "", false, *out.loadContents)
+           && readField(n, "loadListing", "", "", false, *out.loadListing);
+}
+
+inline auto readFields(NodeRef const & n, cwl::FieldBase & out) -> bool {
+    return readFields(n, static_cast<cwl::Labeled &>(out))
+           && readField(n, "secondaryFiles", "", "", false, *out.secondaryFiles)
+           && readField(n, "streamable", "", "", false, *out.streamable);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputFormat & out) -> bool {
+    return readField(n, "format", "", "", false, *out.format);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputFormat & out) -> bool {
+    return readField(n, "format", "", "", false, *out.format);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Parameter & out) -> bool {
+    return readFields(n, static_cast<cwl::FieldBase &>(out))
+           && readFields(n, static_cast<salad::Documented &>(out))
+           && readFields(n, static_cast<cwl::Identified &>(out));
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputBinding & out) -> bool {
+    return readField(n, "loadContents", "", "", false, *out.loadContents);
+}
+
+inline auto readFields(NodeRef const & n, cwl::IOSchema & out) -> bool {
+    return readFields(n, static_cast<cwl::Labeled &>(out))
+           && readFields(n, static_cast<salad::Documented &>(out))
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputSchema & out) -> bool {
+    return readFields(n, static_cast<cwl::IOSchema &>(out));
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputSchema & out) -> bool {
+    return readFields(n, static_cast<cwl::IOSchema &>(out));
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputRecordField & out) -> bool {
+    return readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "secondaryFiles", "", "", false, *out.secondaryFiles)
+           && readField(n, "streamable", "", "", false, *out.streamable)
+           && readField(n, "format", "", "", false, *out.format)
+           && readField(n, "loadContents", "", "", false, *out.loadContents)
+           && readField(n, "loadListing", "", "", false, *out.loadListing);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputRecordSchema & out) -> bool {
+    return readField(n, "fields", "name", "type", false, *out.fields)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputEnumSchema & out) -> bool {
+    return readFields(n, static_cast<salad::EnumSchema &>(out))
+           && readFields(n, static_cast<cwl::InputSchema &>(out));
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputArraySchema & out) -> bool {
+    return readField(n, "items", "", "", false, *out.items)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputRecordField & out) -> bool {
+    return readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "secondaryFiles", "", "", false, *out.secondaryFiles)
+           && readField(n, "streamable", "", "", false, *out.streamable)
+           && readField(n, "format", "", "", false, *out.format);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputRecordSchema & out) -> bool {
+    return readField(n, "fields", "name", "type", false, *out.fields)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputEnumSchema & out) -> bool {
+    return readFields(n, static_cast<salad::EnumSchema &>(out))
+           && readFields(n, static_cast<cwl::OutputSchema &>(out));
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputArraySchema & out) -> bool {
+    return readField(n, "items", "", "", false, *out.items)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::Parameter &>(out))
+           && readFields(n, static_cast<cwl::InputFormat &>(out))
+           && readFields(n, static_cast<cwl::LoadContents &>(out))
+           && readField(n, "default", "", "", false, *out.default_);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OutputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::Parameter &>(out))
+           && readFields(n, static_cast<cwl::OutputFormat &>(out));
+}
+
+inline auto readFields(NodeRef const &, cwl::ProcessRequirement &) -> bool {
+    return true;
+}
+
+inline auto readFields(NodeRef const & n, cwl::Process & out) -> bool {
+    return readFields(n, static_cast<cwl::Identified &>(out))
+           && readFields(n, static_cast<cwl::Labeled &>(out))
+           && readFields(n, static_cast<salad::Documented &>(out))
+           && readField(n, "inputs", "id", "type", false, *out.inputs)
+           && readField(n, "outputs", "id", "type", false, *out.outputs)
+           && readField(n, "requirements", "class", "", false, *out.requirements)
+           && readField(n, "hints", "class", "", false, *out.hints)
+           && readField(n, "cwlVersion", "", "", false, *out.cwlVersion)
+           && readField(n, "intent", "", "", false, *out.intent);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InlineJavascriptRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "expressionLib", "", "", false, *out.expressionLib);
+}
+
+inline auto readFields(NodeRef const &, cwl::CommandInputSchema &) -> bool {
+    return true;
+}
+
+inline auto readFields(NodeRef const & n, cwl::SchemaDefRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "types", "", "", false, *out.types);
+}
+
+inline auto readFields(NodeRef const & n, cwl::SecondaryFileSchema & out) -> bool {
+    return readField(n, "pattern", "", "", false, *out.pattern)
+           && readField(n, "required", "", "", false, *out.required);
+}
+
+inline auto readFields(NodeRef const & n, cwl::LoadListingRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "loadListing", "", "", false, *out.loadListing);
+}
+
+inline auto readFields(NodeRef const & n, cwl::EnvironmentDef & out) -> bool {
+    return readField(n, "envName", "", "", false, *out.envName)
+           && readField(n, "envValue", "", "", false, *out.envValue);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandLineBinding & out) -> bool {
+    return readFields(n, static_cast<cwl::InputBinding &>(out))
+           && readField(n, "position", "", "", false, *out.position)
+           && readField(n, "prefix", "", "", false, *out.prefix)
+           && readField(n, "separate", "", "", false, *out.separate)
+           && readField(n, "itemSeparator", "", "", false, *out.itemSeparator)
+           && readField(n, "valueFrom", "", "", false, *out.valueFrom)
+           && readField(n, "shellQuote", "", "", false, *out.shellQuote);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandOutputBinding & out) -> bool {
+    return readFields(n, static_cast<cwl::LoadContents &>(out))
+           && readField(n, "glob", "", "", false, *out.glob)
+           && readField(n, "outputEval", "", "", false, *out.outputEval);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandLineBindable & out) -> bool {
+    return readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandInputRecordField & out) -> bool {
+    return readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "secondaryFiles", "", "", false, *out.secondaryFiles)
+           && readField(n, "streamable", "", "", false, *out.streamable)
+           && readField(n, "format", "", "", false, *out.format)
+           && readField(n, "loadContents", "", "", false, *out.loadContents)
+           && readField(n, "loadListing", "", "", false, *out.loadListing)
+           && readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandInputRecordSchema & out) -> bool {
+    return readField(n, "fields", "name", "type", false, *out.fields)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandInputEnumSchema & out) -> bool {
+    return readField(n, "name", "", "", false, *out.name)
+           && readField(n, "symbols", "", "", false, *out.symbols)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandInputArraySchema & out) -> bool {
+    return readField(n, "items", "", "", false, *out.items)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandOutputRecordField & out) -> bool {
+    return readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "secondaryFiles", "", "", false, *out.secondaryFiles)
+           && readField(n, "streamable", "", "", false, *out.streamable)
+           && readField(n, "format", "", "", false, *out.format)
+           && readField(n, "outputBinding", "", "", false, *out.outputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandOutputRecordSchema & out) -> bool {
+    return readField(n, "fields", "name", "type", false, *out.fields)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandOutputEnumSchema & out) -> bool {
+    return readField(n, "name", "", "", false, *out.name)
+           && readField(n, "symbols", "", "", false, *out.symbols)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandOutputArraySchema & out) -> bool {
+    return readField(n, "items", "", "", false, *out.items)
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "name", "", "", false, *out.name);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandInputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::InputParameter &>(out))
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandOutputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::OutputParameter &>(out))
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "outputBinding", "", "", false, *out.outputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::CommandLineTool & out) -> bool {
+    return readField(n, "id", "", "", false, *out.id)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "inputs", "id", "type", false, *out.inputs)
+           && readField(n, "outputs", "id", "type", false, *out.outputs)
+           && readField(n, "requirements", "class", "", false, *out.requirements)
+           && readField(n, "hints", "class", "", false, *out.hints)
+           && readField(n, "cwlVersion", "", "", false, *out.cwlVersion)
+           && readField(n, "intent", "", "", false, *out.intent)
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "baseCommand", "", "", false, *out.baseCommand)
+           && readField(n, "arguments", "", "", false, *out.arguments)
+           && readField(n, "stdin", "", "", false, *out.stdin_)
+           && readField(n, "stderr", "", "", false, *out.stderr_)
+           && readField(n, "stdout", "", "", false, *out.stdout_)
+           && readField(n, "successCodes", "", "", false, *out.successCodes)
+           && readField(n, "temporaryFailCodes", "", "", false, *out.temporaryFailCodes)
+           && readField(n, "permanentFailCodes", "", "", false, *out.permanentFailCodes);
+}
+
+inline auto readFields(NodeRef const & n, cwl::DockerRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "dockerPull", "", "", false, *out.dockerPull)
+           && readField(n, "dockerLoad", "", "", false, *out.dockerLoad)
+           && readField(n, "dockerFile", "", "", false, *out.dockerFile)
+           && readField(n, "dockerImport", "", "", false, *out.dockerImport)
+           && readField(n, "dockerImageId", "", "", false, *out.dockerImageId)
+           && readField(n, "dockerOutputDirectory", "", "", false, *out.dockerOutputDirectory);
+}
+
+inline auto readFields(NodeRef const & n, cwl::SoftwareRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "packages", "package", "specs", false, *out.packages);
+}
+
+inline auto readFields(NodeRef const & n, cwl::SoftwarePackage & out) -> bool {
+    return readField(n, "package", "", "", false, *out.package)
+           && readField(n, "version", "", "", false, *out.version)
+           && readField(n, "specs", "", "", false, *out.specs);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Dirent & out) -> bool {
+    return readField(n, "entryname", "", "", false, *out.entryname)
+           && readField(n, "entry", "", "", false, *out.entry)
+           && readField(n, "writable", "", "", false, *out.writable);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InitialWorkDirRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "listing", "", "", false, *out.listing);
+}
+
+inline auto readFields(NodeRef const & n, cwl::EnvVarRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "envDef", "envName", "envValue", false, *out.envDef);
+}
+
+inline auto readFields(NodeRef const & n, cwl::ShellCommandRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_);
+}
+
+inline auto readFields(NodeRef const & n, cwl::ResourceRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "coresMin", "", "", false, *out.coresMin)
+           && readField(n, "coresMax", "", "", false, *out.coresMax)
+           && readField(n, "ramMin", "", "", false, *out.ramMin)
+           && readField(n, "ramMax", "", "", false, *out.ramMax)
+           && readField(n, "tmpdirMin", "", "", false, *out.tmpdirMin)
+           && readField(n, "tmpdirMax", "", "", false, *out.tmpdirMax)
+           && readField(n, "outdirMin", "", "", false, *out.outdirMin)
+           && readField(n, "outdirMax", "", "", false, *out.outdirMax);
+}
+
+inline auto readFields(NodeRef const & n, cwl::WorkReuse & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "enableReuse", "", "", false, *out.enableReuse);
+}
+
+inline auto readFields(NodeRef const & n, cwl::NetworkAccess & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "networkAccess", "", "", false, *out.networkAccess);
+}
+
+inline auto readFields(NodeRef const & n, cwl::InplaceUpdateRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "inplaceUpdate", "", "", false, *out.inplaceUpdate);
+}
+
+inline auto readFields(NodeRef const & n, cwl::ToolTimeLimit & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "timelimit", "", "", false, *out.timelimit);
+}
+
+inline auto readFields(NodeRef const & n, cwl::ExpressionToolOutputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::OutputParameter &>(out))
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, cwl::WorkflowInputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::InputParameter &>(out))
+           && readField(n, "type", "", "", true, *out.type)
+           && readField(n, "inputBinding", "", "", false, *out.inputBinding);
+}
+
+inline auto readFields(NodeRef const & n, cwl::ExpressionTool & out) -> bool {
+    return readField(n, "id", "", "", false, *out.id)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "inputs", "id", "type", false, *out.inputs)
+           && readField(n, "outputs", "id", "type", false, *out.outputs)
+           && readField(n, "requirements", "class", "", false, *out.requirements)
+           && readField(n, "hints", "class", "", false, *out.hints)
+           && readField(n, "cwlVersion", "", "", false, *out.cwlVersion)
+           && readField(n, "intent", "", "", false, *out.intent)
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "expression", "", "", false, *out.expression);
+}
+
+inline auto readFields(NodeRef const & n, cwl::WorkflowOutputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::OutputParameter &>(out))
+           && readField(n, "outputSource", "", "", false, *out.outputSource)
+           && readField(n, "linkMerge", "", "", false, *out.linkMerge)
+           && readField(n, "pickValue", "", "", false, *out.pickValue)
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Sink & out) -> bool {
+    return readField(n, "source", "", "", false, *out.source)
+           && readField(n, "linkMerge", "", "", false, *out.linkMerge)
+           && readField(n, "pickValue", "", "", false, *out.pickValue);
+}
+
+inline auto readFields(NodeRef const & n, cwl::WorkflowStepInput & out) -> bool {
+    return readFields(n, static_cast<cwl::Identified &>(out))
+           && readFields(n, static_cast<cwl::Sink &>(out))
+           && readFields(n, static_cast<cwl::LoadContents &>(out))
+           && readFields(n, static_cast<cwl::Labeled &>(out))
+           && readField(n, "default", "", "", false, *out.default_)
+           && readField(n, "valueFrom", "", "", false, *out.valueFrom);
+}
+
+inline auto readFields(NodeRef const & n, cwl::WorkflowStepOutput & out) -> bool {
+    return readFields(n, static_cast<cwl::Identified &>(out));
+}
+
+inline auto readFields(NodeRef const & n, cwl::WorkflowStep & out) -> bool {
+    return readFields(n, static_cast<cwl::Identified &>(out))
+           && readFields(n, static_cast<cwl::Labeled &>(out))
+           && readFields(n, static_cast<salad::Documented &>(out))
+           && readField(n, "in", "id", "source", false, *out.in)
+           && readField(n, "out", "", "", false, *out.out)
+           && readField(n, "requirements", "class", "", false, *out.requirements)
+           && readField(n, "hints", "class", "", false, *out.hints)
+           && readField(n, "run", "", "", false, *out.run)
+           && readField(n, "when", "", "", false, *out.when)
+           && readField(n, "scatter", "", "", false, *out.scatter)
+           && readField(n, "scatterMethod", "", "", false, *out.scatterMethod);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Workflow & out) -> bool {
+    return readField(n, "id", "", "", false, *out.id)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "inputs", "id", "type", false, *out.inputs)
+           && readField(n, "outputs", "id", "type", false, *out.outputs)
+           && readField(n, "requirements", "class", "", false, *out.requirements)
+           && readField(n, "hints", "class", "", false, *out.hints)
+           && readField(n, "cwlVersion", "", "", false, *out.cwlVersion)
+           && readField(n, "intent", "", "", false, *out.intent)
+           && readField(n, "class", "", "", false, *out.class_)
+           && readField(n, "steps", "id", "", false, *out.steps);
+}
+
+inline auto readFields(NodeRef const & n, cwl::SubworkflowFeatureRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_);
+}
+
+inline auto readFields(NodeRef const & n, cwl::ScatterFeatureRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_);
+}
+
+inline auto readFields(NodeRef const & n, cwl::MultipleInputFeatureRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_);
+}
+
+inline auto readFields(NodeRef const & n, cwl::StepInputExpressionRequirement & out) -> bool {
+    return readFields(n, static_cast<cwl::ProcessRequirement &>(out))
+           && readField(n, "class", "", "", false, *out.class_);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OperationInputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::InputParameter &>(out))
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, cwl::OperationOutputParameter & out) -> bool {
+    return readFields(n, static_cast<cwl::OutputParameter &>(out))
+           && readField(n, "type", "", "", true, *out.type);
+}
+
+inline auto readFields(NodeRef const & n, cwl::Operation & out) -> bool {
+    return readField(n, "id", "", "", false, *out.id)
+           && readField(n, "label", "", "", false, *out.label)
+           && readField(n, "doc", "", "", false, *out.doc)
+           && readField(n, "inputs", "id", "type", false, *out.inputs)
+           && readField(n, "outputs", "id", "type", false, *out.outputs)
+           && readField(n, "requirements", "class", "", false, *out.requirements)
+           && readField(n, "hints", "class", "", false, *out.hints)
+           && readField(n, "cwlVersion", "", "", false, *out.cwlVersion)
+           && readField(n, "intent", "", "", false, *out.intent)
+           && readField(n, "class", "", "", false, *out.class_);
+}
+
+inline auto detect(NodeRef const & n, std::optional<salad::RecordSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = salad::RecordSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<salad::EnumSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = salad::EnumSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<salad::ArraySchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = salad::ArraySchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::File> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::File{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::Directory> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::Directory{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::InputRecordSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::InputRecordSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::InputArraySchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::InputArraySchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::OutputRecordSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::OutputRecordSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::OutputArraySchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::OutputArraySchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::InlineJavascriptRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::InlineJavascriptRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::SchemaDefRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::SchemaDefRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::LoadListingRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::LoadListingRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandInputRecordSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandInputRecordSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandInputEnumSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandInputEnumSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandInputArraySchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandInputArraySchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandOutputRecordSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandOutputRecordSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandOutputEnumSchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandOutputEnumSchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandOutputArraySchema> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandOutputArraySchema{};
+    if (readConstant(n, "type", *res.type) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::CommandLineTool> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::CommandLineTool{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::DockerRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::DockerRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::SoftwareRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::SoftwareRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::InitialWorkDirRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::InitialWorkDirRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::EnvVarRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::EnvVarRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::ShellCommandRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::ShellCommandRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::ResourceRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::ResourceRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::WorkReuse> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::WorkReuse{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::NetworkAccess> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::NetworkAccess{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::InplaceUpdateRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::InplaceUpdateRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::ToolTimeLimit> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::ToolTimeLimit{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::ExpressionTool> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::ExpressionTool{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::Workflow> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::Workflow{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::SubworkflowFeatureRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::SubworkflowFeatureRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::ScatterFeatureRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::ScatterFeatureRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::MultipleInputFeatureRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::MultipleInputFeatureRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::StepInputExpressionRequirement> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::StepInputExpressionRequirement{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+inline auto detect(NodeRef const & n, std::optional<cwl::Operation> & out) -> bool {
+    if (n.type() != NodeType::Map) {
+        return true;
+    }
+    auto res = cwl::Operation{};
+    if (readConstant(n, "class", *res.class_) && readFields(n, res)) {
+        out = std::move(res);
+        return true;
+    }
+    return true;
+}
+
+// end of the generated records
+
+//!\brief like fromYaml, appends the elements, a node that is not a sequence adds nothing
+template <typename T>
+auto read(NodeRef const & node, std::vector<T> & out) -> bool {
+    if (node.type() == NodeType::Undefined) {
+        return false;
+    }
+    return node.forEachElement([&](NodeRef const & element) {
+        out.emplace_back();
+        return read(element, out.back());
+    });
+}
+
+template <typename Variant, typename Head, typename... Tail>
+auto readAlternative(NodeRef const & node, Variant & out) -> bool {
+    auto value = std::optional<Head>{};
+    if (!detect(node, value)) {
+        return false;
+    }
+    if (value) {
+        out = std::move(*value);
+        return true;
+    }
+    if constexpr (sizeof...(Tail) > 0) {
+        return readAlternative<Variant, Tail...>(node, out);
+    }
+    return false;
+}
+
+//!\brief the first detected alternative, an optional value (monostate or one type) is read without detection
+template <typename... Args>
+auto read(NodeRef const & node, std::variant<Args...> & out) -> bool {
+    using Variant = std::variant<Args...>;
+    if constexpr (sizeof...(Args) == 2 && std::is_same_v<std::variant_alternative_t<0, Variant>, std::monostate>) {
+        if (node.type() == NodeType::Undefined) {
+            out = std::monostate{};
+            return true;
+        }
+        auto value = std::variant_alternative_t<1, Variant>{};
+        if (!read(node, value)) {
+            return false;
+        }
+        out = std::move(value);
+        return true;
+    } else {
+        return readAlternative<Variant, Args...>(node, out);
+    }
+}
+
+//!\brief enums and records
+template <typename T>
+auto read(NodeRef const & node, T & out) -> bool {
+    if constexpr (std::is_enum_v<T>) {
+        auto value = std::string{};
+        return read(node, value) && try_to_enum(value, out);
+    } else {
+        return readFields(node, out);
+    }
+}
+
+/*!\brief records the events of yaml-cpp's parser and reads the processes from them
+ *
+ * The root of each document is a process, unless it is a map with a `$graph` list. Then each element of the
+ * list is a process, it is read when it is complete. Without anchors in it its events are dropped afterwards.
+ */
+class DocumentReader : public YAML::EventHandler {
+public:
+    explicit DocumentReader(std::vector<DocumentRootType> & documents) : documents{documents} {}
+
+    void OnDocumentStart(YAML::Mark const &) override {
+        tape.events.clear();
+        tape.text.clear();
+        open.clear();
+        anchors.clear();
+        rootEntries = 0;
+        graphKey    = false;
+        graph       = npos;
+    }
+
+    void OnDocumentEnd() override {
+        if (!tape.events.empty() && graph == npos) {
+            readProcess(0);
+        }
+    }
+
+    void OnNull(YAML::Mark const &, YAML::anchor_t anchor) override {
+        auto start = begin();
+        added(start, tape.addNull(), anchor);
+    }
+
+    void OnAlias(YAML::Mark const &, YAML::anchor_t anchor) override {
+        auto start = begin();
+        added(start, tape.addAlias(anchors[anchor]), YAML::NullAnchor);
+    }
+
+    void OnScalar(YAML::Mark const &, std::string const &, YAML::anchor_t anchor, std::string const & value) override {
+        auto start = begin();
+        auto index = tape.addScalar(value);
+        if (start.isGraphKey) {
+            graphKey = value == "$graph";
+        }
+        added(start, index, anchor);
+    }
+
+    void OnSequenceStart(YAML::Mark const &, std::string const &, YAML::anchor_t anchor, YAML::EmitterStyle::value)
+        override {
+        auto start = begin();
+        auto index = tape.beginContainer(EventKind::Sequence);
+        if (start.isGraphValue && graphKey && graph == npos) {
+            graph = index;
+        }
+        opened(start, index, anchor);
+    }
+
+    void OnSequenceEnd() override {
+        closed();
+    }
+
+    void OnMapStart(YAML::Mark const &, std::string const &, YAML::anchor_t anchor, YAML::EmitterStyle::value)
+        override {
+        opened(begin(), tape.beginContainer(EventKind::Map), anchor);
+    }
+
+    void OnMapEnd() override {
+        closed();
+    }
+
+private:
+    static constexpr auto npos = static_cast<size_t>(-1);
+
+    //!\brief the position of a new node in the document
+    struct Start {
+        bool   isGraphKey{};     //!< a key of the root map
+        bool   isGraphValue{};   //!< a value of the root map
+        bool   isGraphElement{}; //!< an element of the `$graph` list
+        size_t textSize{};       //!< size of the text before the node
+    };
+
+    std::vector<DocumentRootType> & documents;
+    Tape                            tape{};
+    std::vector<size_t>             open{};    //!< the containers that are not closed yet
+    std::vector<Start>              starts{};  //!< where the open containers started
+    std::vector<size_t>             anchors{}; //!< event of each anchor
+    size_t                          rootEntries{};
+    bool                            graphKey{};
+    size_t                          graph{npos};
+
+    auto begin() -> Start {
+        auto start     = Start{};
+        start.textSize = tape.text.size();
+        if (open.size() == 1 && tape.events[0].kind == EventKind::Map) {
+            auto entry         = rootEntries++;
+            start.isGraphKey   = entry % 2 == 0;
+            start.isGraphValue = entry % 2 == 1;
+            if (start.isGraphKey) {
+                graphKey = false;
+            }
+        } else if (open.size() == 2 && open[1] == graph) {
+            start.isGraphElement = true;
+        }
+        return start;
+    }
+
+    void added(Start const & start, size_t index, YAML::anchor_t anchor) {
+        if (anchor != YAML::NullAnchor) {
+            anchors.resize(std::max(anchors.size(), anchor + 1));
+            anchors[anchor] = index;
+        }
+        if (start.isGraphElement) {
+            readGraphElement(start, index);
+        }
+    }
+
+    void opened(Start const & start, size_t index, YAML::anchor_t anchor) {
+        if (anchor != YAML::NullAnchor) {
+            anchors.resize(std::max(anchors.size(), anchor + 1));
+            anchors[anchor] = index;
+        }
+        open.push_back(index);
+        starts.resize(open.size());
+        starts.back() = start;
+    }
+
+    void closed() {
+        auto index = open.back();
+        auto start = starts[open.size() - 1];
+        tape.endContainer(index);
+        open.pop_back();
+        if (start.isGraphElement) {
+            readGraphElement(start, index);
+        }
+    }
+
+    void readGraphElement(Start const & start, size_t index) {
+        readProcess(index);
+        // events of an element with anchors stay, later elements may refer to them
+        for (auto anchored : anchors) {
+            if (anchored >= index) {
+                return;
+            }
+        }
+        tape.events.resize(index);
+        tape.text.resize(start.textSize);
+    }
+
+    void readProcess(size_t index) {
+        auto process = DocumentRootType{};
+        if (!read(NodeRef::event(tape, index), process)) {
+            throw std::runtime_error{"didn't find any overload"};
+        }
+        documents.push_back(std::move(process));
+    }
+};
+
+} // namespace w3id_org::cwl::stream
+
+namespace w3id_org::cwl {
+
+/*!\brief loads all documents of a yaml stream, the elements of a `$graph` list are separate processes
+ *
+ * Reads the same structs as load_document, but from the parser events directly (see cwl_v1_2_stream.h).
+ * Throws std::runtime_error if a process does not match any of the DocumentRootType alternatives.
+ */
+inline auto load_documents_from_stream(std::istream & input) -> std::vector<DocumentRootType> {
+    auto documents = std::vector<DocumentRootType>{};
+    auto reader    = stream::DocumentReader{documents};
+    auto parser    = YAML::Parser{input};
+    while (parser.HandleNextDocument(reader)) {}
+    return documents;
+}
+
+inline auto load_documents_from_string(std::string const & document) -> std::vector<DocumentRootType> {
+    auto input = std::istringstream{document};
+    return load_documents_from_stream(input);
+}
+
+inline auto load_documents(std::filesystem::path const & path) -> std::vector<DocumentRootType> {
+    auto input = std::ifstream{path, std::ios::binary};
+    if (!input) {
+        throw YAML::BadFile{path.string()};
+    }
+    return load_documents_from_stream(input);
+}
+
+} // namespace w3id_org::cwl
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "escapeXML.h"
+
+#include <cstdint>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#    define TDL_ESCAPE_XML_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define TDL_ESCAPE_XML_SSE2
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif
+
+namespace tdl::detail {
+
+namespace {
+
+//!\brief index of the lowest set bit, `mask` must not be zero
+[[maybe_unused]] auto countTrailingZeros(uint32_t mask) noexcept -> size_t {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index{};
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+
+//!\brief scalar search, used for the tail of the string and if no SIMD instructions are available
+auto findXMLEscapeScalar(char const * data, size_t pos, size_t size) noexcept -> size_t {
+    for (; pos < size; ++pos) {
+        if (!xmlEscapeTable[static_cast<unsigned char>(data[pos])].empty()) {
+            return pos;
+        }
+    }
+    return std::string_view::npos;
+}
+
+} // namespace
+
+auto findXMLEscape(std::string_view str) noexcept -> size_t {
+    auto const * data = str.data();
+    auto const   size = str.size();
+    size_t       pos{0};
+
+#if defined(TDL_ESCAPE_XML_AVX2)
+    auto const amp  = _mm256_set1_epi8('&');
+    auto const gt   = _mm256_set1_epi8('>');
+    auto const quot = _mm256_set1_epi8('"');
+    auto const lt   = _mm256_set1_epi8('<');
+    auto const apos = _mm256_set1_epi8('\'');
+    auto const tab  = _mm256_set1_epi8('\t');
+    auto const nl   = _mm256_set1_epi8('\n');
+    for (; pos + 32 <= size; pos += 32) {
+        auto const chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(data + pos));
+        auto       found = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, amp), _mm256_cmpeq_epi8(chunk, gt));
+        found            = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, quot));
+        found            = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, lt));
+        found            = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, apos));
+        found            = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, tab));
+        found            = _mm256_or_si256(found, _mm256_cmpeq_epi8(chunk, nl));
+        auto const mask  = static_cast<uint32_t>(_mm256_movemask_epi8(found));
+        if (mask != 0) {
+            return pos + countTrailingZeros(mask);
+        }
+    }
+#elif defined(TDL_ESCAPE_XML_SSE2)
+    auto const amp  = _mm_set1_epi8('&');
+    auto const gt   = _mm_set1_epi8('>');
+    auto const quot = _mm_set1_epi8('"');
+    auto const lt   = _mm_set1_epi8('<');
+    auto const apos = _mm_set1_epi8('\'');
+    auto const tab  = _mm_set1_epi8('\t');
+    auto const nl   = _mm_set1_epi8('\n');
+    for (; pos + 16 <= size; pos += 16) {
+        auto const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + pos));
+        auto       found = _mm_or_si128(_mm_cmpeq_epi8(chunk, amp), _mm_cmpeq_epi8(chunk, gt));
+        found            = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, quot));
+        found            = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, lt));
+        found            = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, apos));
+        found            = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, tab));
+        found            = _mm_or_si128(found, _mm_cmpeq_epi8(chunk, nl));
+        auto const mask  = static_cast<uint32_t>(_mm_movemask_epi8(found));
+        if (mask != 0) {
+            return pos + countTrailingZeros(mask);
+        }
+    }
+#endif
+
+    return findXMLEscapeScalar(data, pos, size);
+}
+
+auto escapeXML(std::string str) -> std::string {
+    auto pos = findXMLEscape(str);
+    if (pos == std::string_view::npos) {
+        return str;
+    }
+
+    auto out = std::string{};
+    out.reserve(str.size() + str.size() / 8 + 8);
+
+    auto view = std::string_view{str};
+    for (; pos != std::string_view::npos; pos = findXMLEscape(view)) {
+        out.append(view.substr(0, pos));
+        out.append(xmlEscapeTable[static_cast<unsigned char>(view[pos])]);
+        view.remove_prefix(pos + 1);
+    }
+    out.append(view);
+    return out;
+}
+
+auto findXMLUnescape(std::string_view str) noexcept -> size_t {
+    for (auto pos = str.find_first_of("&#"); pos != std::string_view::npos; pos = str.find_first_of("&#", pos + 1)) {
+        if (str[pos] == '&' || str.substr(pos, 4) == "#br#") {
+            return pos;
+        }
+    }
+    return std::string_view::npos;
+}
+
+namespace {
+
+//!\brief appends the utf-8 encoding of `codePoint`
+void appendUTF8(std::string & out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        out.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        out.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    } else if (codePoint < 0x10000) {
+        out.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    } else {
+        out.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+}
+
+//!\brief resolves a numeric character reference like "#x9" or "#10", returns false if `ref` is not valid
+auto appendCharacterReference(std::string & out, std::string_view ref) -> bool {
+    auto base = 10u;
+    ref.remove_prefix(1);
+    if (!ref.empty() && (ref.front() == 'x' || ref.front() == 'X')) {
+        base = 16u;
+        ref.remove_prefix(1);
+    }
+    if (ref.empty() || ref.size() > 8) {
+        return false;
+    }
+
+    auto codePoint = uint32_t{};
+    for (auto c : ref) {
+        auto digit = uint32_t{};
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<uint32_t>(c - '0');
+        } else if (base == 16u && c >= 'a' && c <= 'f') {
+            digit = static_cast<uint32_t>(c - 'a' + 10);
+        } else if (base == 16u && c >= 'A' && c <= 'F') {
+            digit = static_cast<uint32_t>(c - 'A' + 10);
+        } else {
+            return false;
+        }
+        codePoint = codePoint * base + digit;
+    }
+    if (codePoint > 0x10ffff) {
+        return false;
+    }
+    appendUTF8(out, codePoint);
+    return true;
+}
+
+} // namespace
+
+void appendUnescapedXML(std::string & out, std::string_view str) {
+    for (auto pos = findXMLUnescape(str); pos != std::string_view::npos; pos = findXMLUnescape(str)) {
+        out.append(str.substr(0, pos));
+        str.remove_prefix(pos);
+
+        if (str[0] == '#') { // "#br#"
+            out.push_back('\n');
+            str.remove_prefix(4);
+            continue;
+        }
+
+        auto end    = str.find(';');
+        auto entity = str.substr(1, end == std::string_view::npos ? 0 : end - 1);
+        if (entity == "amp") {
+            out.push_back('&');
+        } else if (entity == "lt") {
+            out.push_back('<');
+        } else if (entity == "gt") {
+            out.push_back('>');
+        } else if (entity == "quot") {
+            out.push_back('"');
+        } else if (entity == "apos") {
+            out.push_back('\'');
+        } else if (entity.empty() || entity[0] != '#' || !appendCharacterReference(out, entity)) {
+            // unknown entity, keep the '&' and continue after it
+            out.push_back('&');
+            str.remove_prefix(1);
+            continue;
+        }
+        str.remove_prefix(end + 1);
+    }
+    out.append(str);
+}
+
+} // namespace tdl::detail
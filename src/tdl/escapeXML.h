@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace tdl::detail {
+
+//!\brief replacement of each character that is not allowed inside XML attributes, empty if none is required
+inline constexpr auto xmlEscapeTable = []() {
+    auto table = std::array<std::string_view, 256>{};
+
+    table['&']  = "&amp;";
+    table['>']  = "&gt;";
+    table['"']  = "&quot;";
+    table['<']  = "&lt;";
+    table['\''] = "&apos;";
+    table['\t'] = "&#x9;";
+    table['\n'] = "#br#";
+    return table;
+}();
+
+/*!\brief position of the first character in `str` that must be escaped
+ *
+ * Uses SSE2/AVX2 if available, otherwise falls back to a table lookup.
+ * \return position of the character or std::string_view::npos if none exists
+ */
+auto findXMLEscape(std::string_view str) noexcept -> size_t;
+
+/*!\brief writes `str` with all special characters escaped into `out`
+ *
+ * Unescaped parts are passed on as slices of `str`, so nothing is copied if
+ * `str` contains no special characters.
+ */
+template <typename Sink>
+void writeEscapedXML(Sink & out, std::string_view str) {
+    for (auto pos = findXMLEscape(str); pos != std::string_view::npos; pos = findXMLEscape(str)) {
+        out(str.substr(0, pos));
+        out(xmlEscapeTable[static_cast<unsigned char>(str[pos])]);
+        str.remove_prefix(pos + 1);
+    }
+    out(str);
+}
+
+//!\brief required replacements to use strings safely inside XML documents
+auto escapeXML(std::string str) -> std::string;
+
+//!\brief position of the first escape sequence ('&...;' or "#br#") in `str`, or std::string_view::npos
+auto findXMLUnescape(std::string_view str) noexcept -> size_t;
+
+/*!\brief appends `str` with all escape sequences replaced by the original characters to `out`
+ *
+ * Inverse of escapeXML. Additionally to the sequences written by escapeXML, numeric character
+ * references are resolved. Unknown entities are copied unchanged.
+ */
+void appendUnescapedXML(std::string & out, std::string_view str);
+
+} // namespace tdl::detail
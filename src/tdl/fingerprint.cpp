@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "fingerprint.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <variant>
+
+namespace tdl {
+
+namespace {
+
+/*!\brief streaming MurmurHash3_x64_128
+ *
+ * Blocks are read byte by byte as little endian, the result is the same on every platform.
+ */
+class Hasher {
+public:
+    void add(unsigned char const * data, size_t size) {
+        length += size;
+        if (buffered > 0) {
+            auto count = std::min(size, buffer.size() - buffered);
+            std::memcpy(buffer.data() + buffered, data, count);
+            buffered += count;
+            data += count;
+            size -= count;
+            if (buffered < buffer.size()) {
+                return;
+            }
+            block(buffer.data());
+            buffered = 0;
+        }
+        for (; size >= buffer.size(); data += buffer.size(), size -= buffer.size()) {
+            block(data);
+        }
+        std::memcpy(buffer.data(), data, size);
+        buffered = size;
+    }
+
+    void add(uint64_t value) {
+        auto bytes = std::array<unsigned char, 8>{};
+        for (size_t i{0}; i < bytes.size(); ++i) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+        add(bytes.data(), bytes.size());
+    }
+
+    //!\brief the length first, so that consecutive strings cannot be split differently
+    void add(std::string_view value) {
+        add(static_cast<uint64_t>(value.size()));
+        add(reinterpret_cast<unsigned char const *>(value.data()), value.size());
+    }
+
+    void add(int value) {
+        add(static_cast<uint64_t>(static_cast<int64_t>(value)));
+    }
+
+    void add(double value) {
+        if (std::isnan(value)) {
+            value = std::numeric_limits<double>::quiet_NaN();
+        }
+        auto bits = uint64_t{};
+        static_assert(sizeof(bits) == sizeof(value));
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(bits);
+    }
+
+    auto finish() const -> Fingerprint {
+        auto h1 = this->h1;
+        auto h2 = this->h2;
+
+        // the remaining bytes, as in the tail of MurmurHash3
+        auto k1 = uint64_t{0};
+        auto k2 = uint64_t{0};
+        for (size_t i{buffered}; i > 8; --i) {
+            k2 ^= static_cast<uint64_t>(buffer[i - 1]) << (8 * (i - 9));
+        }
+        if (buffered > 8) {
+            h2 ^= mixK2(k2);
+        }
+        for (size_t i{std::min<size_t>(buffered, 8)}; i > 0; --i) {
+            k1 ^= static_cast<uint64_t>(buffer[i - 1]) << (8 * (i - 1));
+        }
+        if (buffered > 0) {
+            h1 ^= mixK1(k1);
+        }
+
+        h1 ^= length;
+        h2 ^= length;
+        h1 += h2;
+        h2 += h1;
+        h1 = finalMix(h1);
+        h2 = finalMix(h2);
+        h1 += h2;
+        h2 += h1;
+        return {h1, h2};
+    }
+
+private:
+    static constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+    static constexpr uint64_t c2 = 0x4cf5ad432745937full;
+
+    std::array<unsigned char, 16> buffer{};
+    size_t                        buffered{};
+    uint64_t                      length{};
+    uint64_t                      h1{};
+    uint64_t                      h2{};
+
+    static auto rotl(uint64_t x, int r) noexcept -> uint64_t {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static auto load(unsigned char const * data) noexcept -> uint64_t {
+        auto value = uint64_t{0};
+        for (size_t i{0}; i < 8; ++i) {
+            value |= static_cast<uint64_t>(data[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    static auto mixK1(uint64_t k1) noexcept -> uint64_t {
+        return rotl(k1 * c1, 31) * c2;
+    }
+
+    static auto mixK2(uint64_t k2) noexcept -> uint64_t {
+        return rotl(k2 * c2, 33) * c1;
+    }
+
+    static auto finalMix(uint64_t k) noexcept -> uint64_t {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ull;
+        k ^= k >> 33;
+        return k;
+    }
+
+    void block(unsigned char const * data) noexcept {
+        h1 ^= mixK1(load(data));
+        h1 = rotl(h1, 27) + h2;
+        h1 = h1 * 5 + 0x52dce729;
+        h2 ^= mixK2(load(data + 8));
+        h2 = rotl(h2, 31) + h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+};
+
+template <typename T>
+void addOptional(Hasher & hasher, std::optional<T> const & value) {
+    hasher.add(static_cast<uint64_t>(value.has_value()));
+    if (value) {
+        hasher.add(*value);
+    }
+}
+
+template <typename List>
+void addList(Hasher & hasher, List const & list) {
+    hasher.add(static_cast<uint64_t>(list.size()));
+    for (auto const & value : list) {
+        hasher.add(value);
+    }
+}
+
+template <typename T, typename ListType>
+void addValue(Hasher & hasher, detail::TValue<T, ListType> const & value) {
+    if constexpr (detail::is_vector_v<ListType>) {
+        addList(hasher, value.value);
+    } else {
+        hasher.add(value.value);
+    }
+    addOptional(hasher, value.minLimit);
+    addOptional(hasher, value.maxLimit);
+}
+
+template <typename T, typename ListType, typename ValidList>
+void addValue(Hasher & hasher, detail::TStringValue<T, ListType, ValidList> const & value) {
+    if constexpr (detail::is_vector_v<ListType>) {
+        addList(hasher, value.value);
+    } else {
+        hasher.add(std::string_view{value.value});
+    }
+    hasher.add(static_cast<uint64_t>(value.validValues.has_value()));
+    if (value.validValues) {
+        addList(hasher, *value.validValues);
+    }
+}
+
+void addValue(Hasher & hasher, bool value) {
+    hasher.add(static_cast<uint64_t>(value));
+}
+
+template <typename Children>
+void addChildren(Hasher & hasher, Children const & children) {
+    hasher.add(static_cast<uint64_t>(children.size()));
+    for (auto const & child : children) {
+        hasher.add(std::string_view{child.name});
+        hasher.add(std::string_view{child.description});
+        addList(hasher, child.tags);
+
+        // the index of the alternative, as the same payload may be held by different alternatives
+        hasher.add(static_cast<uint64_t>(child.value.index()));
+        std::visit(
+            [&](auto const & value) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(value)>, Children>) {
+                    addChildren(hasher, value);
+                } else {
+                    addValue(hasher, value);
+                }
+            },
+            child.value);
+    }
+}
+
+template <typename ToolInfoT>
+auto fingerprintTool(ToolInfoT const & doc) -> Fingerprint {
+    auto hasher = Hasher{};
+
+    auto const & metaInfo = doc.metaInfo;
+    for (auto const & field : {std::string_view{metaInfo.version},
+                               std::string_view{metaInfo.name},
+                               std::string_view{metaInfo.docurl},
+                               std::string_view{metaInfo.category},
+                               std::string_view{metaInfo.description},
+                               std::string_view{metaInfo.executableName}}) {
+        hasher.add(field);
+    }
+    hasher.add(static_cast<uint64_t>(metaInfo.citations.size()));
+    for (auto const & citation : metaInfo.citations) {
+        hasher.add(std::string_view{citation.doi});
+        hasher.add(std::string_view{citation.url});
+    }
+
+    addChildren(hasher, doc.params);
+
+    hasher.add(static_cast<uint64_t>(doc.cliMapping.size()));
+    for (auto const & mapping : doc.cliMapping) {
+        hasher.add(std::string_view{mapping.optionIdentifier});
+        hasher.add(std::string_view{mapping.referenceName});
+    }
+    return hasher.finish();
+}
+
+} // namespace
+
+auto Fingerprint::toString() const -> std::string {
+    constexpr auto digits = std::string_view{"0123456789abcdef"};
+
+    auto result = std::string(32, '0');
+    for (size_t i{0}; i < 16; ++i) {
+        result[15 - i] = digits[(high >> (4 * i)) & 0xf];
+        result[31 - i] = digits[(low >> (4 * i)) & 0xf];
+    }
+    return result;
+}
+
+auto fingerprint(ToolInfo const & doc) -> Fingerprint {
+    return fingerprintTool(doc);
+}
+
+#if TDL_HAS_PMR
+auto fingerprint(pmr::ToolInfo const & doc) -> Fingerprint {
+    return fingerprintTool(doc);
+}
+#endif
+
+namespace detail {
+
+auto fingerprintBytes(std::string_view data) -> Fingerprint {
+    auto hasher = Hasher{};
+    hasher.add(reinterpret_cast<unsigned char const *>(data.data()), data.size());
+    return hasher.finish();
+}
+
+} // namespace detail
+
+} // namespace tdl
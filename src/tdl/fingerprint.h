@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "ToolInfo.h"
+#include "pmr.h"
+
+namespace tdl {
+
+//!\brief a 128 bit hash of the content of a ToolInfo
+struct Fingerprint {
+    uint64_t low{};
+    uint64_t high{};
+
+    //!\brief 32 lower case hex digits, the high half first
+    auto toString() const -> std::string;
+
+    friend auto operator==(Fingerprint const & lhs, Fingerprint const & rhs) noexcept -> bool {
+        return lhs.low == rhs.low && lhs.high == rhs.high;
+    }
+    friend auto operator!=(Fingerprint const & lhs, Fingerprint const & rhs) noexcept -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+/*!\brief structural hash of `doc`, covering metaInfo, all nodes including their values and limits, and cliMapping
+ *
+ * The hash is computed over a canonical encoding of the content (little endian integers, strings with
+ * their length, tags in sorted order, all NaNs alike), so it does not depend on memory layout, allocator,
+ * platform or run. Equal documents have equal fingerprints; a tdl::pmr::ToolInfo has the fingerprint of
+ * the tdl::ToolInfo it was copied from. The hash is MurmurHash3 (x64, 128 bit), it is not cryptographic.
+ */
+auto fingerprint(ToolInfo const & doc) -> Fingerprint;
+
+#if TDL_HAS_PMR
+auto fingerprint(pmr::ToolInfo const & doc) -> Fingerprint;
+#endif
+
+namespace detail {
+
+//!\brief the same hash over arbitrary bytes, e.g. to combine a fingerprint with other data
+auto fingerprintBytes(std::string_view data) -> Fingerprint;
+
+} // namespace detail
+
+} // namespace tdl
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "flatTree.h"
+
+#include <unordered_map>
+
+namespace tdl {
+
+namespace {
+
+//!\brief bit mask of the given tags
+auto tagMask(std::initializer_list<Tag> tags) noexcept -> uint16_t {
+    auto mask = uint16_t{0};
+    for (auto tag : tags) {
+        mask |= static_cast<uint16_t>(1u << static_cast<uint8_t>(tag));
+    }
+    return mask;
+}
+
+} // namespace
+
+//!\brief appends the nodes of `params` in pre-order
+template <typename Children>
+void FlatTree::build(Children const & params) {
+    // interned names, the keys refer to the names of the tree
+    auto ids = std::unordered_map<std::string_view, uint32_t>{};
+
+    auto visit = [&](auto & self, Children const & children, uint32_t parent, uint16_t depth) -> void {
+        for (auto const & child : children) {
+            auto node             = static_cast<uint32_t>(parents.size());
+            auto [iter, inserted] = ids.try_emplace(child.name, static_cast<uint32_t>(ids.size()));
+            if (inserted) {
+                nameOffsets.push_back(static_cast<uint32_t>(namePool.size()));
+                namePool.append(child.name);
+            }
+
+            parents.push_back(parent);
+            subtreeEnds.push_back(node + 1);
+            nameIds.push_back(iter->second);
+            depths.push_back(depth);
+            tagBits.push_back(child.tags.knownTags());
+            kinds.push_back(static_cast<ValueKind>(child.value.index()));
+
+            if (auto grandChildren = std::get_if<Children>(&child.value)) {
+                self(self, *grandChildren, node, static_cast<uint16_t>(depth + 1));
+                subtreeEnds[node] = static_cast<uint32_t>(parents.size());
+            }
+        }
+    };
+    visit(visit, params, noParent, 0);
+    nameOffsets.push_back(static_cast<uint32_t>(namePool.size()));
+}
+
+FlatTree::FlatTree(Node::Children const & params) {
+    build(params);
+}
+
+#if TDL_HAS_PMR
+FlatTree::FlatTree(pmr::Node::Children const & params) {
+    build(params);
+}
+#endif
+
+auto FlatTree::findName(std::string_view name) const noexcept -> std::optional<uint32_t> {
+    for (uint32_t id{0}; id < nameCount(); ++id) {
+        if (internedName(id) == name) {
+            return id;
+        }
+    }
+    return std::nullopt;
+}
+
+auto FlatTree::find(std::string_view name) const -> std::vector<uint32_t> {
+    auto result = std::vector<uint32_t>{};
+    if (auto id = findName(name)) {
+        for (uint32_t node{0}; node < size(); ++node) {
+            if (nameIds[node] == *id) {
+                result.push_back(node);
+            }
+        }
+    }
+    return result;
+}
+
+auto FlatTree::withTags(std::initializer_list<Tag> tags) const -> std::vector<uint32_t> {
+    auto mask   = tagMask(tags);
+    auto result = std::vector<uint32_t>{};
+    for (uint32_t node{0}; node < size(); ++node) {
+        if ((tagBits[node] & mask) == mask) {
+            result.push_back(node);
+        }
+    }
+    return result;
+}
+
+auto FlatTree::withTags(ValueKind kind, std::initializer_list<Tag> tags) const -> std::vector<uint32_t> {
+    auto mask   = tagMask(tags);
+    auto result = std::vector<uint32_t>{};
+    for (uint32_t node{0}; node < size(); ++node) {
+        if (kinds[node] == kind && (tagBits[node] & mask) == mask) {
+            result.push_back(node);
+        }
+    }
+    return result;
+}
+
+auto FlatTree::path(size_t node, char separator) const -> std::string {
+    // collect the ancestors bottom up, then join them top down
+    auto ancestors = std::vector<uint32_t>{};
+    for (auto n = static_cast<uint32_t>(node); n != noParent; n = parents[n]) {
+        ancestors.push_back(n);
+    }
+
+    auto result = std::string{};
+    for (auto iter = ancestors.rbegin(); iter != ancestors.rend(); ++iter) {
+        if (iter != ancestors.rbegin()) {
+            result += separator;
+        }
+        result += name(*iter);
+    }
+    return result;
+}
+
+} // namespace tdl
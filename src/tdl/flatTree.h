@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "ToolInfo.h"
+#include "pmr.h"
+
+namespace tdl {
+
+//!\brief the alternative held by Node::Value, in the same order
+enum class ValueKind : uint8_t {
+    Bool,
+    Int,
+    Double,
+    String,
+    IntList,
+    DoubleList,
+    StringList,
+    Children,
+};
+
+static_assert(static_cast<size_t>(ValueKind::Children) + 1 == std::variant_size_v<Node::Value>);
+
+/*!\brief an immutable, flattened view of a parameter tree
+ *
+ * The nodes of `ToolInfo::params` are numbered in pre-order, each property is stored in its own array
+ * (structure of arrays). Queries are linear scans over these arrays instead of recursive walks.
+ * The names are interned, nodes with the same name share one id.
+ *
+ * Only the tags listed in Tag are part of the view (as bits, see Tags::knownTags), the values themselves are not.
+ * The view is a copy, it does not refer to the tree it was built from.
+ */
+class FlatTree {
+public:
+    //!\brief parent of the top level parameters
+    static constexpr uint32_t noParent = std::numeric_limits<uint32_t>::max();
+
+    FlatTree() = default;
+
+    explicit FlatTree(Node::Children const & params);
+
+#if TDL_HAS_PMR
+    explicit FlatTree(pmr::Node::Children const & params);
+#endif
+
+    //!\brief number of nodes in the tree
+    auto size() const noexcept -> size_t {
+        return parents.size();
+    }
+
+    auto empty() const noexcept -> bool {
+        return parents.empty();
+    }
+
+    //!\brief index of the parent of `node`, noParent for top level parameters
+    auto parent(size_t node) const noexcept -> uint32_t {
+        return parents[node];
+    }
+
+    //!\brief 0 for top level parameters
+    auto depth(size_t node) const noexcept -> uint16_t {
+        return depths[node];
+    }
+
+    auto kind(size_t node) const noexcept -> ValueKind {
+        return kinds[node];
+    }
+
+    //!\brief the known tags of `node` as bits, see Tags::knownTags
+    auto tags(size_t node) const noexcept -> uint16_t {
+        return tagBits[node];
+    }
+
+    auto hasTag(size_t node, Tag tag) const noexcept -> bool {
+        return (tagBits[node] >> static_cast<uint8_t>(tag)) & 1u;
+    }
+
+    //!\brief the descendants of `node` are the nodes in [node + 1, subtreeEnd(node))
+    auto subtreeEnd(size_t node) const noexcept -> uint32_t {
+        return subtreeEnds[node];
+    }
+
+    //!\brief id of the interned name of `node`
+    auto nameId(size_t node) const noexcept -> uint32_t {
+        return nameIds[node];
+    }
+
+    auto name(size_t node) const noexcept -> std::string_view {
+        return internedName(nameIds[node]);
+    }
+
+    //!\brief id of an interned name, std::nullopt if no node has this name
+    auto findName(std::string_view name) const noexcept -> std::optional<uint32_t>;
+
+    //!\brief number of distinct names
+    auto nameCount() const noexcept -> size_t {
+        return nameOffsets.empty() ? 0 : nameOffsets.size() - 1;
+    }
+
+    //!\brief the name with the given id
+    auto internedName(uint32_t id) const noexcept -> std::string_view {
+        return std::string_view{namePool}.substr(nameOffsets[id], nameOffsets[id + 1] - nameOffsets[id]);
+    }
+
+    //!\brief all nodes with the given name, in pre-order
+    auto find(std::string_view name) const -> std::vector<uint32_t>;
+
+    //!\brief all nodes that carry all of the given tags, in pre-order
+    auto withTags(std::initializer_list<Tag> tags) const -> std::vector<uint32_t>;
+
+    //!\brief all nodes of the given kind that carry all of the given tags, in pre-order
+    auto withTags(ValueKind kind, std::initializer_list<Tag> tags) const -> std::vector<uint32_t>;
+
+    //!\brief names from the top level down to `node`, joined by `separator`, e.g. "section:param"
+    auto path(size_t node, char separator = ':') const -> std::string;
+
+private:
+    std::vector<uint32_t>  parents{};
+    std::vector<uint32_t>  subtreeEnds{};
+    std::vector<uint32_t>  nameIds{};
+    std::vector<uint16_t>  depths{};
+    std::vector<uint16_t>  tagBits{};
+    std::vector<ValueKind> kinds{};
+
+    std::string           namePool{};    //!< all interned names, concatenated
+    std::vector<uint32_t> nameOffsets{}; //!< start of each name in namePool, followed by the end of the last one
+
+    template <typename Children>
+    void build(Children const & params);
+};
+
+} // namespace tdl
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "jsonWriter.h"
+
+namespace tdl::detail {
+
+namespace {
+
+constexpr auto isDigit(char c) noexcept -> bool {
+    return c >= '0' && c <= '9';
+}
+
+constexpr auto needsEscape(char c) noexcept -> bool {
+    return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+} // namespace
+
+void JSONWriter::key(std::string_view str) {
+    separate();
+    appendJSONString(out, str);
+    out += ':';
+    comma = false;
+}
+
+void JSONWriter::string(std::string_view str) {
+    separate();
+    appendJSONString(out, str);
+    comma = true;
+}
+
+void JSONWriter::scalar(std::string_view str) {
+    if (str != "true" && str != "false" && !isJSONNumber(str)) {
+        string(str);
+        return;
+    }
+    separate();
+    out += str;
+    comma = true;
+}
+
+auto isJSONNumber(std::string_view str) noexcept -> bool {
+    auto pos    = size_t{0};
+    auto digits = [&] {
+        auto start = pos;
+        while (pos < str.size() && isDigit(str[pos])) {
+            ++pos;
+        }
+        return pos > start;
+    };
+
+    if (pos < str.size() && str[pos] == '-') {
+        ++pos;
+    }
+    // no leading zeros
+    if (pos < str.size() && str[pos] == '0') {
+        ++pos;
+    } else if (!digits()) {
+        return false;
+    }
+    if (pos < str.size() && str[pos] == '.') {
+        ++pos;
+        if (!digits()) {
+            return false;
+        }
+    }
+    if (pos < str.size() && (str[pos] == 'e' || str[pos] == 'E')) {
+        ++pos;
+        if (pos < str.size() && (str[pos] == '+' || str[pos] == '-')) {
+            ++pos;
+        }
+        if (!digits()) {
+            return false;
+        }
+    }
+    return pos == str.size();
+}
+
+void appendJSONString(std::string & out, std::string_view str) {
+    constexpr auto hex = std::string_view{"0123456789abcdef"};
+
+    out += '"';
+    auto start = size_t{0};
+    for (size_t i{0}; i < str.size(); ++i) {
+        auto c = str[i];
+        if (!needsEscape(c)) {
+            continue;
+        }
+        out.append(str.data() + start, i - start);
+        start = i + 1;
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\b': out += "\\b"; break;
+        case '\f': out += "\\f"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            out += "\\u00";
+            out += hex[static_cast<unsigned char>(c) >> 4];
+            out += hex[static_cast<unsigned char>(c) & 0xF];
+        }
+    }
+    out.append(str.data() + start, str.size() - start);
+    out += '"';
+}
+
+} // namespace tdl::detail
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace tdl::detail {
+
+/*!\brief writes a compact JSON document event by event into a string
+ *
+ * Receives the same events as YAMLWriter, so the same code writes both formats.
+ * A map expects alternating `key()` and value calls, a value is either a scalar or a nested collection.
+ */
+class JSONWriter {
+public:
+    explicit JSONWriter(std::string & out) : out{out} {}
+
+    void beginMap() {
+        separate();
+        out += '{';
+        comma = false;
+    }
+    void endMap() {
+        out += '}';
+        comma = true;
+    }
+    void beginSeq() {
+        separate();
+        out += '[';
+        comma = false;
+    }
+    void endSeq() {
+        out += ']';
+        comma = true;
+    }
+
+    //!\brief JSON has no numbers for NaN and infinity, values that need them are not written
+    static constexpr bool nonFiniteNumbers = false;
+
+    //!\brief key of the next map entry
+    void key(std::string_view str);
+
+    //!\brief a string value
+    void string(std::string_view str);
+
+    /*!\brief a value that is not a string (number, bool) as YAMLWriter receives it
+     *
+     * Text that is no JSON number, `true` or `false` is written as string, e.g. `.nan` and `.inf`.
+     */
+    void scalar(std::string_view str);
+
+    void null() {
+        separate();
+        out += "null";
+        comma = true;
+    }
+
+private:
+    std::string & out;
+    bool          comma{}; //!< the next key or value is preceded by a comma
+
+    void separate() {
+        if (comma) {
+            out += ',';
+        }
+    }
+};
+
+//!\brief true if `str` is a number in JSON syntax
+auto isJSONNumber(std::string_view str) noexcept -> bool;
+
+//!\brief appends `str` as JSON string, quotes, backslashes and control characters are escaped
+void appendJSONString(std::string & out, std::string_view str);
+
+} // namespace tdl::detail
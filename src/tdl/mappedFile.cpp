@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "mappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#    define TDL_MAPPED_FILE_WIN32
+#elif __has_include(<sys/mman.h>)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define TDL_MAPPED_FILE_POSIX
+#else
+#    include <fstream>
+#    include <sstream>
+#endif
+
+namespace tdl::detail {
+
+namespace {
+[[noreturn]] void throwOpenError(std::filesystem::path const & path) {
+    throw std::runtime_error{"cannot read file " + path.string()};
+}
+} // namespace
+
+#if defined(TDL_MAPPED_FILE_WIN32)
+MappedFile::MappedFile(std::filesystem::path const & path) {
+    auto file = CreateFileW(path.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                            nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throwOpenError(path);
+    }
+
+    auto fileSize = LARGE_INTEGER{};
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throwOpenError(path);
+    }
+    if (fileSize.QuadPart == 0) { // empty files can not be mapped
+        CloseHandle(file);
+        return;
+    }
+
+    auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        throwOpenError(path);
+    }
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // the view keeps the mapping alive
+    if (view == nullptr) {
+        throwOpenError(path);
+    }
+    data = static_cast<char const *>(view);
+    size = static_cast<size_t>(fileSize.QuadPart);
+}
+
+void MappedFile::unmap() noexcept {
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+}
+#elif defined(TDL_MAPPED_FILE_POSIX)
+MappedFile::MappedFile(std::filesystem::path const & path) {
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throwOpenError(path);
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throwOpenError(path);
+    }
+    if (info.st_size == 0) { // empty files can not be mapped
+        ::close(fd);
+        return;
+    }
+
+    auto view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping stays valid
+    if (view == MAP_FAILED) {
+        throwOpenError(path);
+    }
+#    if defined(MADV_SEQUENTIAL)
+    ::madvise(view, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+#    endif
+    data = static_cast<char const *>(view);
+    size = static_cast<size_t>(info.st_size);
+}
+
+void MappedFile::unmap() noexcept {
+    if (data != nullptr) {
+        ::munmap(const_cast<char *>(data), size);
+    }
+}
+#else
+MappedFile::MappedFile(std::filesystem::path const & path) {
+    auto file = std::ifstream{path, std::ios::binary};
+    if (!file) {
+        throwOpenError(path);
+    }
+    auto ss = std::stringstream{};
+    ss << file.rdbuf();
+    buffer = std::move(ss).str();
+    data   = buffer.data();
+    size   = buffer.size();
+}
+
+void MappedFile::unmap() noexcept {}
+#endif
+
+MappedFile::MappedFile(MappedFile && other) noexcept :
+    data{std::exchange(other.data, nullptr)},
+    size{std::exchange(other.size, 0)},
+    buffer{std::move(other.buffer)} {
+    if (!buffer.empty()) {
+        data = buffer.data(); // short strings are not moved, but copied
+    }
+}
+
+MappedFile & MappedFile::operator=(MappedFile && other) noexcept {
+    if (this != &other) {
+        unmap();
+        data   = std::exchange(other.data, nullptr);
+        size   = std::exchange(other.size, 0);
+        buffer = std::move(other.buffer);
+        if (!buffer.empty()) {
+            data = buffer.data();
+        }
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+} // namespace tdl::detail
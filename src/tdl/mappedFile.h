@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace tdl::detail {
+
+/*!\brief read only view of a whole file
+ *
+ * The file is memory mapped (mmap or MapViewOfFile), so its content is not copied.
+ * On other platforms the file is read into a buffer.
+ */
+class MappedFile {
+public:
+    //!\throws std::runtime_error if the file can not be opened or mapped
+    explicit MappedFile(std::filesystem::path const & path);
+    MappedFile(MappedFile && other) noexcept;
+    MappedFile & operator=(MappedFile && other) noexcept;
+    MappedFile(MappedFile const &)             = delete;
+    MappedFile & operator=(MappedFile const &) = delete;
+    ~MappedFile();
+
+    auto view() const noexcept -> std::string_view {
+        return {data, size};
+    }
+
+private:
+    char const * data{};
+    size_t       size{};
+    std::string  buffer{}; //!\brief content of the file, only used if memory mapping is not available
+
+    void unmap() noexcept;
+};
+
+} // namespace tdl::detail
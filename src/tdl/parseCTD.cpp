@@ -0,0 +1,546 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "parseCTD.h"
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "convertToString.h"
+#include "escapeXML.h"
+#include "mappedFile.h"
+
+namespace tdl {
+
+namespace detail {
+
+namespace {
+
+auto isSpace(char c) noexcept -> bool {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+auto isBlank(std::string_view str) noexcept -> bool {
+    for (auto c : str) {
+        if (!isSpace(c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!\brief a minimal pull parser for XML documents
+ *
+ * Reports start tags, end tags, text and CDATA sections as slices of the input.
+ * Processing instructions, comments and DOCTYPE declarations are skipped.
+ * Attributes are not stored, but looked up inside the start tag on request.
+ */
+class XMLReader {
+public:
+    enum class Event {
+        StartElement,
+        EndElement,
+        Text,
+        CData,
+        EndOfDocument
+    };
+
+    explicit XMLReader(std::string_view input) : input{input} {}
+
+    //!\brief moves to the next event, a self closing tag reports a StartElement followed by an EndElement
+    auto next() -> Event {
+        if (selfClosing) {
+            selfClosing = false;
+            return Event::EndElement;
+        }
+
+        while (pos < input.size()) {
+            if (input[pos] != '<') {
+                auto end = std::min(input.find('<', pos), input.size());
+                current  = input.substr(pos, end - pos);
+                pos      = end;
+                return Event::Text;
+            }
+            if (startsWith("<![CDATA[")) {
+                auto begin = pos + 9;
+                skipPast("]]>");
+                current = input.substr(begin, pos - 3 - begin);
+                return Event::CData;
+            }
+            if (startsWith("<?")) {
+                skipPast("?>");
+                continue;
+            }
+            if (startsWith("<!--")) {
+                skipPast("-->");
+                continue;
+            }
+            if (startsWith("<!")) {
+                skipPast(">");
+                continue;
+            }
+            if (startsWith("</")) {
+                pos     = pos + 2;
+                current = readName();
+                pos     = skipSpaces(pos);
+                if (pos >= input.size() || input[pos] != '>') {
+                    error(pos, "expected '>'");
+                }
+                ++pos;
+                return Event::EndElement;
+            }
+
+            ++pos;
+            current         = readName();
+            attributesBegin = pos;
+
+            // validate all attributes and find the end of the tag
+            auto key   = std::string_view{};
+            auto value = std::string_view{};
+            while (nextAttribute(pos, key, value)) {}
+            if (input[pos] == '/') {
+                if (pos + 1 >= input.size() || input[pos + 1] != '>') {
+                    error(pos, "expected '/>'");
+                }
+                selfClosing = true;
+                ++pos;
+            }
+            ++pos;
+            return Event::StartElement;
+        }
+        return Event::EndOfDocument;
+    }
+
+    //!\brief name of the current element or content of the current text/CDATA section
+    auto view() const noexcept -> std::string_view {
+        return current;
+    }
+
+    //!\brief raw (still escaped) value of an attribute of the current start tag
+    auto attribute(std::string_view name) const -> std::optional<std::string_view> {
+        auto p     = attributesBegin;
+        auto key   = std::string_view{};
+        auto value = std::string_view{};
+        while (nextAttribute(p, key, value)) {
+            if (key == name) {
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
+    //!\brief skips all remaining content of the current element including its end tag
+    void skipElement() {
+        for (size_t depth{1}; depth > 0;) {
+            switch (next()) {
+            case Event::StartElement: ++depth; break;
+            case Event::EndElement: --depth; break;
+            case Event::EndOfDocument: error(pos, "unexpected end of document");
+            default: break;
+            }
+        }
+    }
+
+    [[noreturn]] void error(std::string_view message) const {
+        error(pos, message);
+    }
+
+private:
+    std::string_view input;
+    size_t           pos{};
+    std::string_view current{};
+    size_t           attributesBegin{};
+    bool             selfClosing{};
+
+    [[noreturn]] void error(size_t p, std::string_view message) const {
+        auto line = std::count(input.begin(), input.begin() + std::min(p, input.size()), '\n') + 1;
+        throw std::runtime_error{"invalid CTD document (line " + std::to_string(line) + "): " + std::string{message}};
+    }
+
+    auto startsWith(std::string_view prefix) const noexcept -> bool {
+        return input.substr(pos, prefix.size()) == prefix;
+    }
+
+    void skipPast(std::string_view terminator) {
+        auto end = input.find(terminator, pos);
+        if (end == std::string_view::npos) {
+            error(pos, "missing '" + std::string{terminator} + "'");
+        }
+        pos = end + terminator.size();
+    }
+
+    auto skipSpaces(size_t p) const noexcept -> size_t {
+        while (p < input.size() && isSpace(input[p])) {
+            ++p;
+        }
+        return p;
+    }
+
+    auto readName() -> std::string_view {
+        auto begin = pos;
+        while (pos < input.size() && !isSpace(input[pos]) && input[pos] != '>' && input[pos] != '/'
+               && input[pos] != '=') {
+            ++pos;
+        }
+        if (begin == pos) {
+            error(pos, "expected a name");
+        }
+        return input.substr(begin, pos - begin);
+    }
+
+    //!\brief reads the attribute starting at `p`, returns false if the end of the tag is reached
+    auto nextAttribute(size_t & p, std::string_view & key, std::string_view & value) const -> bool {
+        p = skipSpaces(p);
+        if (p >= input.size()) {
+            error(p, "unexpected end of document");
+        }
+        if (input[p] == '>' || input[p] == '/') {
+            return false;
+        }
+
+        auto keyEnd = p;
+        while (keyEnd < input.size() && !isSpace(input[keyEnd]) && input[keyEnd] != '=' && input[keyEnd] != '>'
+               && input[keyEnd] != '/') {
+            ++keyEnd;
+        }
+        key = input.substr(p, keyEnd - p);
+
+        p = skipSpaces(keyEnd);
+        if (p >= input.size() || input[p] != '=') {
+            error(p, "expected '=' after attribute '" + std::string{key} + "'");
+        }
+        p = skipSpaces(p + 1);
+        if (p >= input.size() || (input[p] != '"' && input[p] != '\'')) {
+            error(p, "expected a quoted value for attribute '" + std::string{key} + "'");
+        }
+        auto end = input.find(input[p], p + 1);
+        if (end == std::string_view::npos) {
+            error(p, "unterminated value of attribute '" + std::string{key} + "'");
+        }
+        value = input.substr(p + 1, end - p - 1);
+        p     = end + 1;
+        return true;
+    }
+};
+
+//!\brief calls `cb` for each child element, `cb` has to consume the element, e.g. by calling `skipElement`
+template <typename CB>
+void forEachChild(XMLReader & reader, CB && cb) {
+    for (;;) {
+        switch (reader.next()) {
+        case XMLReader::Event::StartElement: cb(reader.view()); break;
+        case XMLReader::Event::EndElement: return;
+        case XMLReader::Event::EndOfDocument: reader.error("unexpected end of document");
+        default: break; // text between elements is ignored
+        }
+    }
+}
+
+//!\brief unescaped value of an attribute, empty if the attribute does not exist
+auto readAttribute(XMLReader const & reader, std::string_view name) -> std::string {
+    auto out = std::string{};
+    if (auto value = reader.attribute(name)) {
+        appendUnescapedXML(out, *value);
+    }
+    return out;
+}
+
+//!\brief reads the text and CDATA content of an element, whitespace between CDATA sections is ignored
+void readData(XMLReader & reader, std::string & out) {
+    for (;;) {
+        switch (reader.next()) {
+        case XMLReader::Event::Text:
+            if (!isBlank(reader.view())) {
+                appendUnescapedXML(out, reader.view());
+            }
+            break;
+        case XMLReader::Event::CData: out.append(reader.view()); break;
+        case XMLReader::Event::StartElement: reader.skipElement(); break;
+        case XMLReader::Event::EndElement: return;
+        case XMLReader::Event::EndOfDocument: reader.error("unexpected end of document");
+        }
+    }
+}
+
+//!\brief calls `cb` with each unescaped element of a comma separated attribute
+template <typename CB>
+void splitList(std::string_view list, CB && cb) {
+    while (!list.empty()) {
+        auto end   = std::min(list.find(','), list.size());
+        auto value = std::string{};
+        appendUnescapedXML(value, list.substr(0, end));
+        cb(std::move(value));
+        list.remove_prefix(std::min(end + 1, list.size()));
+    }
+}
+
+template <typename T>
+auto parseValue(XMLReader const & reader, std::string_view str) -> T {
+    auto value = [&]() {
+        if constexpr (std::is_integral_v<T>) {
+            return parseInteger<T>(str);
+        } else {
+            return parseDouble(str);
+        }
+    }();
+    if (!value) {
+        reader.error("invalid number '" + std::string{str} + "'");
+    }
+    return *value;
+}
+
+//!\brief reads the 'restrictions' attribute of int and double values, e.g.: "0:10"
+template <typename Value>
+void readLimits(XMLReader const & reader, Value & value) {
+    using T = std::decay_t<decltype(*value.minLimit)>;
+
+    auto restrictions = reader.attribute("restrictions");
+    if (!restrictions || restrictions->empty()) {
+        return;
+    }
+    auto separator = restrictions->find(':');
+    if (separator == std::string_view::npos) {
+        reader.error("invalid restrictions '" + std::string{*restrictions} + "'");
+    }
+    if (auto min = restrictions->substr(0, separator); !min.empty()) {
+        value.minLimit = parseValue<T>(reader, min);
+    }
+    if (auto max = restrictions->substr(separator + 1); !max.empty()) {
+        value.maxLimit = parseValue<T>(reader, max);
+    }
+}
+
+//!\brief reads the valid values of string values, stored in 'restrictions' or 'supported_formats'
+template <typename Value>
+void readValidValues(XMLReader const & reader, Value & value, std::string_view attribute) {
+    auto list = reader.attribute(attribute);
+    if (!list || list->empty()) {
+        return;
+    }
+    value.validValues.emplace();
+    splitList(*list, [&](std::string v) {
+        value.validValues->push_back(std::move(v));
+    });
+}
+
+//!\brief reads the values of all LISTITEM children of an ITEMLIST
+template <typename CB>
+void readListItems(XMLReader & reader, CB && cb) {
+    forEachChild(reader, [&](std::string_view tag) {
+        if (tag == "LISTITEM") {
+            auto value = reader.attribute("value");
+            if (!value) {
+                reader.error("LISTITEM without 'value'");
+            }
+            cb(*value);
+        }
+        reader.skipElement();
+    });
+}
+
+//!\brief reads a NODE, ITEM or ITEMLIST element, the reader must be positioned on its start tag
+auto parseNode(XMLReader & reader) -> Node {
+    auto const tag = reader.view();
+
+    auto node        = Node{};
+    node.name        = readAttribute(reader, "name");
+    node.description = readAttribute(reader, "description");
+    if (auto tags = reader.attribute("tags")) {
+        splitList(*tags, [&](std::string t) {
+            node.tags.insert(std::move(t));
+        });
+    }
+
+    if (tag == "NODE") {
+        auto children = Node::Children{};
+        forEachChild(reader, [&](std::string_view childTag) {
+            if (childTag == "NODE" || childTag == "ITEM" || childTag == "ITEMLIST") {
+                children.push_back(parseNode(reader));
+            } else {
+                reader.skipElement();
+            }
+        });
+        node.value = std::move(children);
+        return node;
+    }
+
+    // convert special xml attributes back to tags
+    for (auto special : {"required", "advanced"}) {
+        if (reader.attribute(special) == std::string_view{"true"}) {
+            node.tags.insert(special);
+        }
+    }
+
+    auto const isList = (tag == "ITEMLIST");
+    auto const type   = reader.attribute("type").value_or("");
+
+    // string values with special types are tagged as files
+    auto fileTag = std::string_view{};
+    if (type == "input-file") {
+        fileTag = "input file";
+    } else if (type == "output-file") {
+        fileTag = "output file";
+    } else if (type == "output-prefix") {
+        fileTag = "output prefix";
+    } else if (type != "string" && type != "int" && type != "double" && type != "float" && type != "bool") {
+        reader.error("unknown type '" + std::string{type} + "' of '" + node.name + "'");
+    }
+    if (!fileTag.empty()) {
+        node.tags.insert(fileTag);
+    }
+    auto const validValuesAttr = fileTag.empty() ? "restrictions" : "supported_formats";
+
+    auto const value = reader.attribute("value").value_or("");
+    if (!isList && type == "bool") {
+        if (value != "true" && value != "false") {
+            reader.error("invalid bool '" + std::string{value} + "' of '" + node.name + "'");
+        }
+        node.value = BoolValue{value == "true"};
+    } else if (!isList && type == "int") {
+        auto v = IntValue{parseValue<int>(reader, value)};
+        readLimits(reader, v);
+        node.value = std::move(v);
+    } else if (!isList && (type == "double" || type == "float")) {
+        auto v = DoubleValue{parseValue<double>(reader, value)};
+        readLimits(reader, v);
+        node.value = std::move(v);
+    } else if (!isList) {
+        auto v = StringValue{};
+        appendUnescapedXML(v.value, value);
+        readValidValues(reader, v, validValuesAttr);
+        node.value = std::move(v);
+    } else if (type == "int") {
+        auto v = IntValueList{};
+        readLimits(reader, v);
+        readListItems(reader, [&](std::string_view e) {
+            v.value.push_back(parseValue<int>(reader, e));
+        });
+        node.value = std::move(v);
+        return node;
+    } else if (type == "double" || type == "float") {
+        auto v = DoubleValueList{};
+        readLimits(reader, v);
+        readListItems(reader, [&](std::string_view e) {
+            v.value.push_back(parseValue<double>(reader, e));
+        });
+        node.value = std::move(v);
+        return node;
+    } else if (type == "bool") {
+        reader.error("lists of bool are not supported ('" + node.name + "')");
+    } else {
+        auto v = StringValueList{};
+        readValidValues(reader, v, validValuesAttr);
+        readListItems(reader, [&](std::string_view e) {
+            appendUnescapedXML(v.value.emplace_back(), e);
+        });
+        node.value = std::move(v);
+        return node;
+    }
+
+    reader.skipElement();
+    return node;
+}
+
+} // namespace
+
+} // namespace detail
+
+auto parseCTD(std::string_view ctd) -> ToolInfo {
+    using detail::XMLReader;
+
+    auto reader = XMLReader{ctd};
+    auto event  = reader.next();
+    while (event == XMLReader::Event::Text && detail::isBlank(reader.view())) {
+        event = reader.next();
+    }
+    if (event != XMLReader::Event::StartElement || reader.view() != "tool") {
+        reader.error("expected <tool> as root element");
+    }
+
+    auto doc      = ToolInfo{};
+    auto & meta   = doc.metaInfo;
+    meta.version  = detail::readAttribute(reader, "version");
+    meta.name     = detail::readAttribute(reader, "name");
+    meta.docurl   = detail::readAttribute(reader, "docurl");
+    meta.category = detail::readAttribute(reader, "category");
+
+    detail::forEachChild(reader, [&](std::string_view tag) {
+        if (tag == "description") {
+            detail::readData(reader, meta.description);
+        } else if (tag == "executableName") {
+            detail::readData(reader, meta.executableName);
+        } else if (tag == "citations") {
+            detail::forEachChild(reader, [&](std::string_view childTag) {
+                if (childTag == "citation") {
+                    meta.citations.push_back({detail::readAttribute(reader, "doi"),
+                                              detail::readAttribute(reader, "url")});
+                }
+                reader.skipElement();
+            });
+        } else if (tag == "PARAMETERS") {
+            detail::forEachChild(reader, [&](std::string_view childTag) {
+                if (childTag == "NODE" || childTag == "ITEM" || childTag == "ITEMLIST") {
+                    doc.params.push_back(detail::parseNode(reader));
+                } else {
+                    reader.skipElement();
+                }
+            });
+        } else if (tag == "cli") {
+            detail::forEachChild(reader, [&](std::string_view childTag) {
+                if (childTag != "clielement") {
+                    reader.skipElement();
+                    return;
+                }
+                auto optionIdentifier = detail::readAttribute(reader, "optionIdentifier");
+                detail::forEachChild(reader, [&](std::string_view mappingTag) {
+                    if (mappingTag == "mapping") {
+                        doc.cliMapping.push_back({optionIdentifier, detail::readAttribute(reader, "referenceName")});
+                    }
+                    reader.skipElement();
+                });
+            });
+        } else { // e.g. <manual>, which duplicates the description
+            reader.skipElement();
+        }
+    });
+
+    // only whitespace and comments may follow the root element
+    for (event = reader.next(); event != XMLReader::Event::EndOfDocument; event = reader.next()) {
+        if (event != XMLReader::Event::Text || !detail::isBlank(reader.view())) {
+            reader.error("unexpected content after </tool>");
+        }
+    }
+    return doc;
+}
+
+auto loadCTD(std::filesystem::path const & path) -> ToolInfo {
+    auto file = detail::MappedFile{path};
+    try {
+        return parseCTD(file.view());
+    } catch (std::runtime_error const & e) {
+        throw std::runtime_error{path.string() + ": " + e.what()};
+    }
+}
+
+auto loadCTDDirectory(std::filesystem::path const & directory) -> std::vector<ToolInfo> {
+    auto paths = std::vector<std::filesystem::path>{};
+    for (auto const & entry : std::filesystem::directory_iterator{directory}) {
+        if (entry.path().extension() == ".ctd" && entry.is_regular_file()) {
+            paths.push_back(entry.path());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    auto toolInfos = std::vector<ToolInfo>{};
+    toolInfos.reserve(paths.size());
+    for (auto const & path : paths) {
+        toolInfos.push_back(loadCTD(path));
+    }
+    return toolInfos;
+}
+
+} // namespace tdl
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief reads a CTD document back into a ToolInfo
+ *
+ * Inverse of convertToCTD: ITEM/ITEMLIST values are rebuilt from their `type`, `restrictions`
+ * and `supported_formats` attributes, `tags` and the `required`/`advanced` attributes become
+ * Node::tags and the `<cli>` section becomes the cliMapping.
+ * The document is read with a streaming pull parser, only the returned ToolInfo allocates.
+ * Thread safety: parseCTD, loadCTD and loadCTDDirectory have no shared state and can be called concurrently.
+ * \throws std::runtime_error if `ctd` is not a valid CTD document
+ */
+auto parseCTD(std::string_view ctd) -> ToolInfo;
+
+/*!\brief reads a CTD file into a ToolInfo
+ *
+ * The file is memory mapped and parsed in place, strings are only copied into the returned ToolInfo.
+ * \throws std::runtime_error if the file can not be read or is not a valid CTD document
+ */
+auto loadCTD(std::filesystem::path const & path) -> ToolInfo;
+
+/*!\brief reads all CTD files (extension ".ctd") of a directory, sorted by their path
+ *
+ * Subdirectories are not searched.
+ * \throws std::runtime_error if a file can not be read or is not a valid CTD document
+ */
+auto loadCTDDirectory(std::filesystem::path const & directory) -> std::vector<ToolInfo>;
+
+} // namespace tdl
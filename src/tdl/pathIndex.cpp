@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pathIndex.h"
+
+#include <stdexcept>
+
+namespace tdl {
+
+PathIndex::PathIndex(Node::Children & params) : params{&params} {
+    auto prefix = std::string{};
+    add(params, prefix);
+}
+
+auto PathIndex::at(std::string_view path) const -> Node & {
+    if (auto node = find(path)) {
+        return *node;
+    }
+    throw std::out_of_range{"no parameter with the path '" + std::string{path} + "'"};
+}
+
+void PathIndex::invalidate(std::string_view path) {
+    if (path.empty()) {
+        index.clear();
+        paths.clear();
+        if (params) {
+            auto prefix = std::string{};
+            add(*params, prefix);
+        }
+        return;
+    }
+
+    auto & node = at(path);
+
+    // all descendants start with "path:", in sorted order they are followed by "path;"
+    auto prefix = std::string{path};
+    prefix += separator;
+    auto first = paths.lower_bound(prefix);
+    prefix.back() = static_cast<char>(separator + 1);
+    auto last     = paths.lower_bound(prefix);
+    for (auto iter = first; iter != last; ++iter) {
+        index.erase(*iter);
+    }
+    paths.erase(first, last);
+
+    if (auto children = std::get_if<Node::Children>(&node.value)) {
+        prefix.back() = separator;
+        add(*children, prefix);
+    }
+}
+
+//!\brief indexes `children` and their descendants, `prefix` is the path of their parent followed by ':'
+void PathIndex::add(Node::Children & children, std::string & prefix) {
+    auto prefixSize = prefix.size();
+    for (auto & child : children) {
+        prefix += child.name;
+        auto [iter, inserted] = paths.insert(prefix);
+        if (inserted) {
+            index.emplace(*iter, &child);
+        }
+        if (auto grandChildren = std::get_if<Node::Children>(&child.value); grandChildren && inserted) {
+            prefix += separator;
+            add(*grandChildren, prefix);
+        }
+        prefix.resize(prefixSize);
+    }
+}
+
+} // namespace tdl
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief lookup of nodes by their full path, e.g. "algorithm:mz:tolerance"
+ *
+ * A path consists of the names from the top level parameter down to the node, separated by ':'.
+ * If siblings share a name, the path refers to the first of them.
+ *
+ * The index refers to the nodes of the tree, it must outlive the index. Changing the values of nodes
+ * does not affect the index. If the children of a node are changed (added, removed, renamed or reallocated),
+ * `invalidate(path)` must be called with the path of that node; `invalidate()` re-indexes the whole tree.
+ * Only the entries below the given path are rebuilt.
+ */
+class PathIndex {
+public:
+    static constexpr char separator = ':';
+
+    PathIndex() = default;
+
+    //!\brief indexes all nodes of `params`
+    explicit PathIndex(Node::Children & params);
+
+    // the keys refer to the strings of `paths`, a copy would refer to the strings of the original
+    PathIndex(PathIndex const &)                         = delete;
+    PathIndex(PathIndex &&) noexcept                     = default;
+    auto operator=(PathIndex const &) -> PathIndex &     = delete;
+    auto operator=(PathIndex &&) noexcept -> PathIndex & = default;
+
+    //!\brief the node with the given path, nullptr if there is none
+    auto find(std::string_view path) const noexcept -> Node * {
+        auto iter = index.find(path);
+        return iter != index.end() ? iter->second : nullptr;
+    }
+
+    //!\throws std::out_of_range if there is no node with the given path
+    auto at(std::string_view path) const -> Node &;
+
+    //!\brief number of indexed nodes
+    auto size() const noexcept -> size_t {
+        return index.size();
+    }
+
+    /*!\brief re-indexes the nodes below `path`, after the children of the node at `path` were changed
+     *
+     * The node at `path` itself must still be valid, otherwise its parent has to be invalidated.
+     * An empty path re-indexes the whole tree.
+     * \throws std::out_of_range if there is no node with the given path
+     */
+    void invalidate(std::string_view path = {});
+
+private:
+    Node::Children *                             params{};
+    std::set<std::string, std::less<>>           paths{}; //!< owns the keys of `index`, sorted to find subtrees
+    std::unordered_map<std::string_view, Node *> index{};
+
+    void add(Node::Children & children, std::string & prefix);
+};
+
+} // namespace tdl
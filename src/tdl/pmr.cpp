@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pmr.h"
+
+#if TDL_HAS_PMR
+
+#    include <type_traits>
+#    include <utility>
+
+namespace tdl::pmr {
+
+namespace {
+
+/*!\brief a string or list of type `Target` in memory of `alloc`
+ *
+ * A source of the same type is moved or copied with the allocator-extended constructor, a move only takes
+ * over the memory if both use the same resource. Sources of other types (std::string, std::vector) are copied
+ * element wise, the elements are constructed with `alloc` as well.
+ */
+template <typename Target, typename Source>
+auto rebind(Source && source, allocator_type alloc) -> Target {
+    if constexpr (std::is_same_v<std::decay_t<Source>, Target>) {
+        return Target(std::forward<Source>(source), alloc);
+    } else if constexpr (std::is_same_v<Target, std::pmr::string>) {
+        return Target(std::string_view{source}, alloc);
+    } else {
+        return Target(source.begin(), source.end(), alloc);
+    }
+}
+
+//!\brief an alternative of Node::Value in memory of `alloc`, `source` is the same alternative of tdl::Node or pmr::Node
+template <typename Target, typename Source>
+auto rebindAlternative(Source && source, allocator_type alloc) -> Target {
+    if constexpr (std::is_same_v<Target, BoolValue> || std::is_same_v<Target, IntValue>
+                  || std::is_same_v<Target, DoubleValue>) {
+        return source;
+    } else if constexpr (std::is_same_v<Target, Node::Children>) {
+        return rebind<Target>(std::forward<Source>(source), alloc);
+    } else if constexpr (std::is_same_v<Target, StringValue> || std::is_same_v<Target, StringValueList>) {
+        auto target = Target{rebind<decltype(Target::value)>(std::forward<Source>(source).value, alloc)};
+        if (source.validValues) {
+            using ValidList = typename decltype(Target::validValues)::value_type;
+            target.validValues.emplace(rebind<ValidList>(*std::forward<Source>(source).validValues, alloc));
+        }
+        return target;
+    } else {
+        return Target{rebind<decltype(Target::value)>(std::forward<Source>(source).value, alloc),
+                      source.minLimit,
+                      source.maxLimit};
+    }
+}
+
+/*!\brief `value` (of a tdl::Node or pmr::Node) in memory of `alloc`
+ *
+ * Node and pmr::Node list the alternatives of their Value in the same order.
+ */
+template <size_t I = 0, typename Value>
+auto rebindValue(Value && value, allocator_type alloc) -> Node::Value {
+    if constexpr (I + 1 < std::variant_size_v<Node::Value>) {
+        if (value.index() != I) {
+            return rebindValue<I + 1>(std::forward<Value>(value), alloc);
+        }
+    }
+    using Target = std::variant_alternative_t<I, Node::Value>;
+    return Node::Value{std::in_place_index<I>,
+                       rebindAlternative<Target>(std::get<I>(std::forward<Value>(value)), alloc)};
+}
+
+//!\brief a copy of a pmr container as std container
+template <typename Target, typename Source>
+auto toStd(Source const & source) -> Target {
+    if constexpr (std::is_same_v<Target, std::string>) {
+        return Target{source};
+    } else {
+        return Target(source.begin(), source.end());
+    }
+}
+
+//!\brief the tdl::Node::Value of `value`
+auto toStdValue(Node::Value const & value) -> tdl::Node::Value {
+    return std::visit(
+        [](auto const & v) -> tdl::Node::Value {
+            using Source = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<Source, BoolValue> || std::is_same_v<Source, IntValue>
+                          || std::is_same_v<Source, DoubleValue>) {
+                return v;
+            } else if constexpr (std::is_same_v<Source, Node::Children>) {
+                auto children = tdl::Node::Children{};
+                children.reserve(v.size());
+                for (auto const & child : v) {
+                    children.push_back(toNode(child));
+                }
+                return children;
+            } else if constexpr (std::is_same_v<Source, StringValue>) {
+                auto target = tdl::StringValue{std::string{v.value}};
+                if (v.validValues) {
+                    target.validValues = toStd<std::vector<std::string>>(*v.validValues);
+                }
+                return target;
+            } else if constexpr (std::is_same_v<Source, StringValueList>) {
+                auto target = tdl::StringValueList{toStd<std::vector<std::string>>(v.value)};
+                if (v.validValues) {
+                    target.validValues = toStd<std::vector<std::string>>(*v.validValues);
+                }
+                return target;
+            } else if constexpr (std::is_same_v<Source, IntValueList>) {
+                return tdl::IntValueList{toStd<std::vector<int>>(v.value), v.minLimit, v.maxLimit};
+            } else {
+                return tdl::DoubleValueList{toStd<std::vector<double>>(v.value), v.minLimit, v.maxLimit};
+            }
+        },
+        value);
+}
+
+} // namespace
+
+Node::Node(allocator_type alloc) : name{alloc}, description{alloc}, tags{alloc}, value{Children{alloc}} {}
+
+Node::Node(std::string_view name, std::string_view description, Tags const & tags, Value value, allocator_type alloc)
+    : name{name, alloc}
+    , description{description, alloc}
+    , tags{tags, alloc}
+    , value{rebindValue(std::move(value), alloc)} {}
+
+Node::Node(tdl::Node const & other, allocator_type alloc)
+    : name{other.name, alloc}
+    , description{other.description, alloc}
+    , tags{other.tags, alloc}
+    , value{rebindValue(other.value, alloc)} {}
+
+Node::Node(Node const & other, allocator_type alloc)
+    : name{other.name, alloc}
+    , description{other.description, alloc}
+    , tags{other.tags, alloc}
+    , value{rebindValue(other.value, alloc)} {}
+
+Node::Node(Node && other, allocator_type alloc)
+    : name{std::move(other.name), alloc}
+    , description{std::move(other.description), alloc}
+    , tags{std::move(other.tags), alloc}
+    , value{rebindValue(std::move(other.value), alloc)} {}
+
+auto Node::operator=(Node const & other) -> Node & {
+    if (this != &other) {
+        name        = other.name;
+        description = other.description;
+        tags        = other.tags;
+        value       = rebindValue(other.value, get_allocator());
+    }
+    return *this;
+}
+
+auto Node::operator=(Node && other) -> Node & {
+    if (this != &other) {
+        name        = std::move(other.name);
+        description = std::move(other.description);
+        tags        = std::move(other.tags);
+        value       = rebindValue(std::move(other.value), get_allocator());
+    }
+    return *this;
+}
+
+MetaInfo::MetaInfo(allocator_type alloc)
+    : version{alloc}
+    , name{alloc}
+    , docurl{alloc}
+    , category{alloc}
+    , description{alloc}
+    , executableName{alloc}
+    , citations{alloc} {}
+
+MetaInfo::MetaInfo(tdl::MetaInfo const & other, allocator_type alloc)
+    : version{other.version, alloc}
+    , name{other.name, alloc}
+    , docurl{other.docurl, alloc}
+    , category{other.category, alloc}
+    , description{other.description, alloc}
+    , executableName{other.executableName, alloc}
+    , citations{alloc} {
+    citations.reserve(other.citations.size());
+    for (auto const & [doi, url] : other.citations) {
+        citations.emplace_back(doi, url);
+    }
+}
+
+MetaInfo::MetaInfo(MetaInfo const & other, allocator_type alloc)
+    : version{other.version, alloc}
+    , name{other.name, alloc}
+    , docurl{other.docurl, alloc}
+    , category{other.category, alloc}
+    , description{other.description, alloc}
+    , executableName{other.executableName, alloc}
+    , citations(other.citations, alloc) {}
+
+MetaInfo::MetaInfo(MetaInfo && other, allocator_type alloc)
+    : version{std::move(other.version), alloc}
+    , name{std::move(other.name), alloc}
+    , docurl{std::move(other.docurl), alloc}
+    , category{std::move(other.category), alloc}
+    , description{std::move(other.description), alloc}
+    , executableName{std::move(other.executableName), alloc}
+    , citations(std::move(other.citations), alloc) {}
+
+ToolInfo::ToolInfo(tdl::ToolInfo const & other, allocator_type alloc)
+    : metaInfo{other.metaInfo, alloc}
+    , params(other.params.begin(), other.params.end(), alloc)
+    , cliMapping{alloc} {
+    cliMapping.reserve(other.cliMapping.size());
+    for (auto const & [optionIdentifier, referenceName] : other.cliMapping) {
+        cliMapping.emplace_back(optionIdentifier, referenceName);
+    }
+}
+
+ToolInfo::ToolInfo(ToolInfo const & other, allocator_type alloc)
+    : metaInfo{other.metaInfo, alloc}
+    , params(other.params, alloc)
+    , cliMapping(other.cliMapping, alloc) {}
+
+ToolInfo::ToolInfo(ToolInfo && other, allocator_type alloc)
+    : metaInfo{std::move(other.metaInfo), alloc}
+    , params(std::move(other.params), alloc)
+    , cliMapping(std::move(other.cliMapping), alloc) {}
+
+auto toNode(Node const & node) -> tdl::Node {
+    return {std::string{node.name}, std::string{node.description}, tdl::Tags{node.tags}, toStdValue(node.value)};
+}
+
+auto toToolInfo(ToolInfo const & doc) -> tdl::ToolInfo {
+    auto result                    = tdl::ToolInfo{};
+    result.metaInfo.version        = doc.metaInfo.version;
+    result.metaInfo.name           = doc.metaInfo.name;
+    result.metaInfo.docurl         = doc.metaInfo.docurl;
+    result.metaInfo.category       = doc.metaInfo.category;
+    result.metaInfo.description    = doc.metaInfo.description;
+    result.metaInfo.executableName = doc.metaInfo.executableName;
+    for (auto const & [doi, url] : doc.metaInfo.citations) {
+        result.metaInfo.citations.push_back({std::string{doi}, std::string{url}});
+    }
+    result.params.reserve(doc.params.size());
+    for (auto const & param : doc.params) {
+        result.params.push_back(toNode(param));
+    }
+    for (auto const & [optionIdentifier, referenceName] : doc.cliMapping) {
+        result.cliMapping.push_back({std::string{optionIdentifier}, std::string{referenceName}});
+    }
+    return result;
+}
+
+} // namespace tdl::pmr
+
+#endif
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#if __has_include(<memory_resource>)
+#    include <memory_resource>
+#endif
+
+//!\brief 1 if the standard library provides std::pmr, the types of this header are only available in that case
+#if defined(__cpp_lib_memory_resource)
+#    define TDL_HAS_PMR 1
+#else
+#    define TDL_HAS_PMR 0
+#endif
+
+#if TDL_HAS_PMR
+
+#    include <cstddef>
+#    include <string>
+#    include <string_view>
+#    include <variant>
+#    include <vector>
+
+#    include "ToolInfo.h"
+
+/*!\brief variants of the ToolInfo types, which allocate from a std::pmr::memory_resource
+ *
+ * A tool description can be placed in a single arena, e.g. a std::pmr::monotonic_buffer_resource:
+ *
+ *     auto arena = std::pmr::monotonic_buffer_resource{};
+ *     auto doc   = tdl::pmr::ToolInfo{tdl::parseCTD(...), &arena};
+ *
+ * All nodes, names, tags and lists are allocated from the arena, releasing it frees them at once.
+ * Nested objects always use the allocator of their parent (uses-allocator construction). Values that
+ * are created without an allocator use the default resource and are copied when they are moved into a node
+ * of another resource. Only constructors and assignments of the types below keep this invariant, a Value
+ * assigned directly to `Node::value` keeps its own allocator.
+ *
+ * convertToCTD and convertToCWL accept pmr::ToolInfo directly.
+ */
+namespace tdl::pmr {
+
+using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+// Value types that are valid entries in the pmr::Node, values without memory are shared with tdl::Node
+using BoolValue       = tdl::BoolValue;
+using IntValue        = tdl::IntValue;
+using DoubleValue     = tdl::DoubleValue;
+using StringValue     = detail::TStringValue<std::pmr::string, std::pmr::string, std::pmr::vector<std::pmr::string>>;
+using IntValueList    = detail::TValue<int, std::pmr::vector<int>>;
+using DoubleValueList = detail::TValue<double, std::pmr::vector<double>>;
+using StringValueList = detail::
+    TStringValue<std::pmr::string, std::pmr::vector<std::pmr::string>, std::pmr::vector<std::pmr::string>>;
+using Tags = BasicTags<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>>;
+
+//!\brief tdl::Node, allocating from a memory resource
+struct Node {
+    using allocator_type = pmr::allocator_type;
+    using Children       = std::pmr::vector<Node>;
+    using Value          = std::variant<BoolValue,
+                                        IntValue,
+                                        DoubleValue,
+                                        StringValue,
+                                        IntValueList,
+                                        DoubleValueList,
+                                        StringValueList,
+                                        Children>;
+
+    std::pmr::string name;
+    std::pmr::string description;
+    Tags             tags;
+    Value            value;
+
+    Node() : Node(allocator_type{}) {}
+    explicit Node(allocator_type alloc);
+
+    //!\brief a node with the given entries, `value` is moved into memory of `alloc` if it is not already there
+    Node(std::string_view name,
+         std::string_view description,
+         Tags const &     tags,
+         Value            value,
+         allocator_type   alloc = {});
+
+    //!\brief a deep copy of a tdl::Node
+    explicit Node(tdl::Node const & other, allocator_type alloc = {});
+
+    Node(Node const & other, allocator_type alloc = {});
+    Node(Node &&) noexcept = default;
+    Node(Node && other, allocator_type alloc);
+
+    //!\brief assignments keep the allocator of the assigned node
+    auto operator=(Node const & other) -> Node &;
+    auto operator=(Node && other) -> Node &;
+
+    auto get_allocator() const noexcept -> allocator_type {
+        return name.get_allocator();
+    }
+};
+
+//!\brief tdl::CLIMapping, allocating from a memory resource
+struct CLIMapping {
+    using allocator_type = pmr::allocator_type;
+
+    std::pmr::string optionIdentifier;
+    std::pmr::string referenceName;
+
+    CLIMapping() : CLIMapping(allocator_type{}) {}
+    explicit CLIMapping(allocator_type alloc) : optionIdentifier{alloc}, referenceName{alloc} {}
+
+    CLIMapping(std::string_view optionIdentifier, std::string_view referenceName, allocator_type alloc = {})
+        : optionIdentifier{optionIdentifier, alloc}, referenceName{referenceName, alloc} {}
+
+    CLIMapping(CLIMapping const & other, allocator_type alloc = {})
+        : optionIdentifier{other.optionIdentifier, alloc}, referenceName{other.referenceName, alloc} {}
+    CLIMapping(CLIMapping &&) noexcept = default;
+    CLIMapping(CLIMapping && other, allocator_type alloc)
+        : optionIdentifier{std::move(other.optionIdentifier), alloc}
+        , referenceName{std::move(other.referenceName), alloc} {}
+
+    auto operator=(CLIMapping const &) -> CLIMapping & = default;
+    auto operator=(CLIMapping &&) -> CLIMapping &      = default;
+
+    auto get_allocator() const noexcept -> allocator_type {
+        return optionIdentifier.get_allocator();
+    }
+};
+
+//!\brief tdl::Citation, allocating from a memory resource
+struct Citation {
+    using allocator_type = pmr::allocator_type;
+
+    std::pmr::string doi;
+    std::pmr::string url;
+
+    Citation() : Citation(allocator_type{}) {}
+    explicit Citation(allocator_type alloc) : doi{alloc}, url{alloc} {}
+
+    Citation(std::string_view doi, std::string_view url, allocator_type alloc = {})
+        : doi{doi, alloc}, url{url, alloc} {}
+
+    Citation(Citation const & other, allocator_type alloc = {}) : doi{other.doi, alloc}, url{other.url, alloc} {}
+    Citation(Citation &&) noexcept = default;
+    Citation(Citation && other, allocator_type alloc)
+        : doi{std::move(other.doi), alloc}, url{std::move(other.url), alloc} {}
+
+    auto operator=(Citation const &) -> Citation & = default;
+    auto operator=(Citation &&) -> Citation &      = default;
+
+    auto get_allocator() const noexcept -> allocator_type {
+        return doi.get_allocator();
+    }
+};
+
+//!\brief tdl::MetaInfo, allocating from a memory resource
+struct MetaInfo {
+    using allocator_type = pmr::allocator_type;
+
+    std::pmr::string           version;
+    std::pmr::string           name;
+    std::pmr::string           docurl;
+    std::pmr::string           category;
+    std::pmr::string           description;
+    std::pmr::string           executableName;
+    std::pmr::vector<Citation> citations;
+
+    MetaInfo() : MetaInfo(allocator_type{}) {}
+    explicit MetaInfo(allocator_type alloc);
+
+    //!\brief a copy of a tdl::MetaInfo
+    explicit MetaInfo(tdl::MetaInfo const & other, allocator_type alloc = {});
+
+    MetaInfo(MetaInfo const & other, allocator_type alloc = {});
+    MetaInfo(MetaInfo &&) noexcept = default;
+    MetaInfo(MetaInfo && other, allocator_type alloc);
+
+    auto operator=(MetaInfo const &) -> MetaInfo & = default;
+    auto operator=(MetaInfo &&) -> MetaInfo &      = default;
+
+    auto get_allocator() const noexcept -> allocator_type {
+        return name.get_allocator();
+    }
+};
+
+//!\brief tdl::ToolInfo, allocating from a memory resource
+struct ToolInfo {
+    using allocator_type = pmr::allocator_type;
+
+    MetaInfo                     metaInfo;
+    Node::Children               params;
+    std::pmr::vector<CLIMapping> cliMapping;
+
+    ToolInfo() : ToolInfo(allocator_type{}) {}
+    explicit ToolInfo(allocator_type alloc) : metaInfo{alloc}, params{alloc}, cliMapping{alloc} {}
+
+    //!\brief a deep copy of a tdl::ToolInfo
+    explicit ToolInfo(tdl::ToolInfo const & other, allocator_type alloc = {});
+
+    ToolInfo(ToolInfo const & other, allocator_type alloc = {});
+    ToolInfo(ToolInfo &&) noexcept = default;
+    ToolInfo(ToolInfo && other, allocator_type alloc);
+
+    auto operator=(ToolInfo const &) -> ToolInfo & = default;
+    auto operator=(ToolInfo &&) -> ToolInfo &      = default;
+
+    auto get_allocator() const noexcept -> allocator_type {
+        return params.get_allocator();
+    }
+};
+
+//!\brief a deep copy of `node` using the default allocator
+auto toNode(Node const & node) -> tdl::Node;
+
+//!\brief a deep copy of `doc` using the default allocator
+auto toToolInfo(ToolInfo const & doc) -> tdl::ToolInfo;
+
+} // namespace tdl::pmr
+
+#endif
@@ -4,6 +4,14 @@
 
 #pragma once
 
+#include "conversionCache.h"
+#include "convertAll.h"
 #include "convertToCTD.h"
 #include "convertToCWL.h"
+#include "fingerprint.h"
+#include "flatTree.h"
+#include "parseCTD.h"
+#include "pathIndex.h"
+#include "pmr.h"
 #include "ToolInfo.h"
+#include "validate.h"
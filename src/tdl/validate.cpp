@@ -0,0 +1,264 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "validate.h"
+
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+
+#include "pathIndex.h"
+
+namespace tdl {
+
+namespace {
+
+template <typename T>
+auto limitViolation(T const & value, std::optional<T> const & minLimit, std::optional<T> const & maxLimit)
+    -> std::optional<ViolationKind> {
+    if (minLimit && *minLimit > value) {
+        return ViolationKind::ValueTooLow;
+    }
+    if (maxLimit && *maxLimit < value) {
+        return ViolationKind::ValueTooHigh;
+    }
+    return std::nullopt;
+}
+
+/*!\brief true if any element of a list is outside of [lo, hi]
+ *
+ * A single pass without early exit or data dependent branches, which the compiler can vectorise.
+ * NaNs compare false, they never violate a limit (same as `state()`).
+ */
+template <typename T>
+auto anyOutside(T const * data, size_t size, T lo, T hi) noexcept -> bool {
+    // a mask as wide as T, so comparisons and accumulation use the same vector lanes
+    using Mask   = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t>;
+    auto outside = Mask{0};
+    for (size_t i{0}; i < size; ++i) {
+        outside |= static_cast<Mask>(data[i] < lo) | static_cast<Mask>(hi < data[i]);
+    }
+    return outside != 0;
+}
+
+template <typename T, typename ListType>
+void validateAlternative(detail::TValue<T, ListType> const & value, ValidationMode mode,
+                         std::vector<Violation> & violations) {
+    auto const & [list, minLimit, maxLimit] = value;
+    if (!minLimit && !maxLimit) {
+        return;
+    }
+    if (minLimit && maxLimit && *minLimit > *maxLimit) {
+        violations.push_back({ViolationKind::LimitsInvalid, 0});
+        return;
+    }
+
+    if constexpr (detail::is_vector_v<ListType>) {
+        // most lists are valid, only search for the offending elements if there are any
+        using limits = std::numeric_limits<T>;
+        auto lo      = minLimit.value_or(limits::has_infinity ? -limits::infinity() : limits::lowest());
+        auto hi      = maxLimit.value_or(limits::has_infinity ? limits::infinity() : limits::max());
+        if (!anyOutside(list.data(), list.size(), lo, hi)) {
+            return;
+        }
+        for (size_t i{0}; i < list.size(); ++i) {
+            if (auto kind = limitViolation(list[i], minLimit, maxLimit)) {
+                violations.push_back({*kind, i});
+                if (mode == ValidationMode::FirstViolation) {
+                    return;
+                }
+            }
+        }
+    } else if (auto kind = limitViolation(list, minLimit, maxLimit)) {
+        violations.push_back({*kind, 0});
+    }
+}
+
+template <typename T, typename ListType, typename ValidList>
+void validateAlternative(detail::TStringValue<T, ListType, ValidList> const & value, ValidationMode mode,
+                         std::vector<Violation> & violations) {
+    if (!value.validValues) {
+        return;
+    }
+
+    if constexpr (detail::is_vector_v<ListType>) {
+        if (value.value.empty()) {
+            return;
+        }
+        auto validValues = ValidValueSet{*value.validValues};
+        for (size_t i{0}; i < value.value.size(); ++i) {
+            if (!validValues.contains(value.value[i])) {
+                violations.push_back({ViolationKind::InvalidValue, i});
+                if (mode == ValidationMode::FirstViolation) {
+                    return;
+                }
+            }
+        }
+    } else if (value.state() == decltype(value.state())::Invalid) {
+        violations.push_back({ViolationKind::InvalidValue, 0});
+    }
+}
+
+//!\brief bool values and children
+template <typename Other>
+void validateAlternative(Other const &, ValidationMode, std::vector<Violation> &) {}
+
+//!\brief true if the validValues of a string value are its supported formats (see convertToCTD), not allowed values
+template <typename TagsT>
+auto holdsFormats(TagsT const & tags) -> bool {
+    return tags.count(Tag::input_file) || tags.count(Tag::output_file) || tags.count(Tag::output_prefix);
+}
+
+//!\brief appends the violations of the value of `node` to `violations`
+template <typename NodeT>
+void validateNodeValue(NodeT const & node, ValidationMode mode, std::vector<Violation> & violations) {
+    using Values = detail::NodeValueTypes<NodeT>;
+
+    if (holdsFormats(node.tags) && (std::holds_alternative<typename Values::StringValue>(node.value)
+                                    || std::holds_alternative<typename Values::StringValueList>(node.value))) {
+        return;
+    }
+    std::visit([&](auto const & alternative) { validateAlternative(alternative, mode, violations); }, node.value);
+}
+
+template <typename NodeT>
+auto validateSingleNode(NodeT const & node, ValidationMode mode) -> std::vector<Violation> {
+    auto violations = std::vector<Violation>{};
+    validateNodeValue(node, mode, violations);
+    return violations;
+}
+
+//!\brief convertToCWL does not descend into nodes at this depth
+constexpr size_t cwlMaxDepth = 5;
+
+//!\brief true if an earlier sibling of `children[pos]` has the same name
+template <typename Children, typename Names>
+auto isDuplicate(Children const & children, size_t pos, Names & names) -> bool {
+    // few siblings are compared directly, many through a hash set
+    constexpr size_t maxLinear = 16;
+    if (children.size() > maxLinear) {
+        return !names.emplace(children[pos].name).second;
+    }
+    for (size_t i{0}; i < pos; ++i) {
+        if (children[i].name == children[pos].name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//!\brief true if convertToCWL skips the output `node`, `inRecord` is true inside sections that are no basecommand
+template <typename NodeT>
+auto isDroppedOutput(NodeT const & node, bool inRecord) -> bool {
+    using Values = detail::NodeValueTypes<NodeT>;
+
+    auto const & tags = node.tags;
+    if (!tags.count(Tag::output)) {
+        return false;
+    }
+    if (std::holds_alternative<typename Values::StringValue>(node.value)) {
+        auto hasType = tags.count(Tag::file) || tags.count(Tag::directory) || tags.count(Tag::prefixed);
+        return !hasType || inRecord;
+    }
+    if (std::holds_alternative<typename Values::StringValueList>(node.value)) {
+        return !tags.count(Tag::prefixed) || inRecord;
+    }
+    return false;
+}
+
+template <typename ToolInfoT>
+auto validateTool(ToolInfoT const & doc, ValidationMode mode) -> std::vector<Diagnostic> {
+    using Children = std::decay_t<decltype(doc.params)>;
+
+    auto diagnostics = std::vector<Diagnostic>{};
+    auto violations  = std::vector<Violation>{};
+    auto path        = std::string{};
+
+    // the cli mappings by referenceName, marked when a node with that name is visited
+    auto mappings   = std::unordered_map<std::string_view, bool>{};
+    auto duplicates = std::vector<size_t>{};
+    mappings.reserve(doc.cliMapping.size());
+    for (size_t i{0}; i < doc.cliMapping.size(); ++i) {
+        if (!mappings.emplace(doc.cliMapping[i].referenceName, false).second) {
+            duplicates.push_back(i);
+        }
+    }
+
+    auto visit = [&](auto & self, Children const & children, size_t depth, bool inRecord) -> void {
+        auto prefixSize = path.size();
+        auto siblings   = std::unordered_set<std::string_view>{};
+        for (size_t i{0}; i < children.size(); ++i) {
+            auto const & child = children[i];
+            path += child.name;
+            if (!mappings.empty()) {
+                if (auto iter = mappings.find(child.name); iter != mappings.end()) {
+                    iter->second = true;
+                }
+            }
+
+            auto report = [&](DiagnosticKind kind, size_t position) {
+                diagnostics.push_back({kind, path, position});
+            };
+            if (depth == cwlMaxDepth) {
+                report(DiagnosticKind::TooDeep, 0);
+            }
+            if (isDuplicate(children, i, siblings)) {
+                report(DiagnosticKind::DuplicateName, 0);
+            }
+            violations.clear();
+            validateNodeValue(child, mode, violations);
+            for (auto const & [kind, position] : violations) {
+                report(static_cast<DiagnosticKind>(kind), position);
+            }
+            if (depth < cwlMaxDepth && isDroppedOutput(child, inRecord)) {
+                report(DiagnosticKind::OutputDropped, 0);
+            }
+
+            if (auto grandChildren = std::get_if<Children>(&child.value)) {
+                path += PathIndex::separator;
+                self(self, *grandChildren, depth + 1, inRecord || !child.tags.count(Tag::basecommand));
+            }
+            path.resize(prefixSize);
+        }
+    };
+    visit(visit, doc.params, 0, false);
+
+    auto duplicate = duplicates.begin();
+    for (size_t i{0}; i < doc.cliMapping.size(); ++i) {
+        auto const & referenceName = doc.cliMapping[i].referenceName;
+        if (!mappings.at(referenceName)) {
+            diagnostics.push_back({DiagnosticKind::UnknownCLIMapping, std::string{referenceName}, i});
+        }
+        if (duplicate != duplicates.end() && *duplicate == i) {
+            diagnostics.push_back({DiagnosticKind::DuplicateCLIMapping, std::string{referenceName}, i});
+            ++duplicate;
+        }
+    }
+    return diagnostics;
+}
+
+} // namespace
+
+auto validateValue(Node const & node, ValidationMode mode) -> std::vector<Violation> {
+    return validateSingleNode(node, mode);
+}
+
+auto validate(ToolInfo const & doc, ValidationMode mode) -> std::vector<Diagnostic> {
+    return validateTool(doc, mode);
+}
+
+#if TDL_HAS_PMR
+auto validateValue(pmr::Node const & node, ValidationMode mode) -> std::vector<Violation> {
+    return validateSingleNode(node, mode);
+}
+
+auto validate(pmr::ToolInfo const & doc, ValidationMode mode) -> std::vector<Diagnostic> {
+    return validateTool(doc, mode);
+}
+#endif
+
+} // namespace tdl
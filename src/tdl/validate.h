@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "ToolInfo.h"
+#include "pmr.h"
+
+namespace tdl {
+
+//!\brief reason why a value does not satisfy its limits or valid values
+enum class ViolationKind : uint8_t {
+    LimitsInvalid, //!< minLimit is larger than maxLimit, the value itself is not checked
+    ValueTooLow,
+    ValueTooHigh,
+    InvalidValue, //!< a string that is not part of validValues
+};
+
+//!\brief a single violation found by validateValue
+struct Violation {
+    ViolationKind kind{};
+    size_t        position{}; //!< index of the offending element of a list, 0 for single values
+
+    friend auto operator==(Violation const & lhs, Violation const & rhs) noexcept -> bool {
+        return lhs.kind == rhs.kind && lhs.position == rhs.position;
+    }
+    friend auto operator!=(Violation const & lhs, Violation const & rhs) noexcept -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+enum class ValidationMode : uint8_t {
+    FirstViolation, //!< stop at the first violation
+    AllViolations,  //!< report every violating element
+};
+
+/*!\brief membership test for the valid values of a string value
+ *
+ * Built once per validValues list and reused for all elements of a list value. Short lists are compared
+ * linearly, longer ones are hashed. The set refers to the strings of the list, the list must outlive the set.
+ */
+class ValidValueSet {
+public:
+    //!\brief lists with more entries are hashed
+    static constexpr size_t hashThreshold = 16;
+
+    template <typename List>
+    explicit ValidValueSet(List const & validValues) {
+        if (validValues.size() > hashThreshold) {
+            hashed.reserve(validValues.size());
+            for (auto const & value : validValues) {
+                hashed.emplace(value);
+            }
+        } else {
+            values.assign(begin(validValues), end(validValues));
+        }
+    }
+
+    auto contains(std::string_view value) const -> bool {
+        if (!hashed.empty()) {
+            return hashed.count(value) > 0;
+        }
+        for (auto const & validValue : values) {
+            if (validValue == value) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::vector<std::string_view>        values{};
+    std::unordered_set<std::string_view> hashed{};
+};
+
+/*!\brief checks the value of `node` against its limits or valid values
+ *
+ * Contrary to `state()` all elements of a list can be reported, including their position.
+ * Bool values and nodes with children never have violations, children are not visited.
+ * The validValues of string values tagged "input file", "output file" or "output prefix" are supported
+ * formats (e.g. "*.fasta"), not allowed values, they are not checked.
+ */
+auto validateValue(Node const & node, ValidationMode mode = ValidationMode::FirstViolation) -> std::vector<Violation>;
+
+#if TDL_HAS_PMR
+auto validateValue(pmr::Node const & node, ValidationMode mode = ValidationMode::FirstViolation)
+    -> std::vector<Violation>;
+#endif
+
+//!\brief true if the value of `node` has no violations
+inline auto isValid(Node const & node) -> bool {
+    return validateValue(node).empty();
+}
+
+//!\brief a problem found by validate, the first four kinds are the ones of ViolationKind
+enum class DiagnosticKind : uint8_t {
+    LimitsInvalid = static_cast<uint8_t>(ViolationKind::LimitsInvalid),
+    ValueTooLow   = static_cast<uint8_t>(ViolationKind::ValueTooLow),
+    ValueTooHigh  = static_cast<uint8_t>(ViolationKind::ValueTooHigh),
+    InvalidValue  = static_cast<uint8_t>(ViolationKind::InvalidValue),
+    DuplicateName,       //!< an earlier sibling has the same name, the node is shadowed in CWL and by PathIndex
+    UnknownCLIMapping,   //!< the referenceName of a cli mapping is not the name of any parameter
+    DuplicateCLIMapping, //!< an earlier cli mapping has the same referenceName, convertToCWL throws for it
+    OutputDropped,       //!< the output tags of the node do not yield a CWL output
+    TooDeep,             //!< the node and its children are nested too deep to be converted to CWL
+};
+
+//!\brief a single problem found by validate
+struct Diagnostic {
+    DiagnosticKind kind{};
+    std::string    path{};     //!< path of the node (see PathIndex), the referenceName for cli mappings
+    size_t         position{}; //!< offending list element, the index into cliMapping for cli mappings
+
+    friend auto operator==(Diagnostic const & lhs, Diagnostic const & rhs) noexcept -> bool {
+        return lhs.kind == rhs.kind && lhs.path == rhs.path && lhs.position == rhs.position;
+    }
+    friend auto operator!=(Diagnostic const & lhs, Diagnostic const & rhs) noexcept -> bool {
+        return !(lhs == rhs);
+    }
+};
+
+/*!\brief checks a whole tool in a single pass over its parameters and cli mappings
+ *
+ * Reports the violations of validateValue for every node, siblings with the same name, cli mappings
+ * referring to no parameter, every cli mapping after the first one with the same referenceName
+ * and parameters that convertToCWL silently skips: outputs without a CWL type
+ * (e.g. a string list without "prefixed"), outputs inside a section that is no basecommand, and nodes
+ * nested deeper than convertToCWL descends (reported once for the topmost such node).
+ * `mode` selects whether all elements of a list or only the first violating one are reported.
+ * The diagnostics are ordered as the nodes in pre-order, followed by the cli mappings.
+ */
+auto validate(ToolInfo const & doc, ValidationMode mode = ValidationMode::FirstViolation) -> std::vector<Diagnostic>;
+
+#if TDL_HAS_PMR
+auto validate(pmr::ToolInfo const & doc, ValidationMode mode = ValidationMode::FirstViolation)
+    -> std::vector<Diagnostic>;
+#endif
+
+} // namespace tdl
@@ -0,0 +1,277 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "yamlWriter.h"
+
+#include <cassert>
+
+namespace tdl::detail {
+
+namespace {
+
+//!\brief keys longer than this are written as '? key' by yaml-cpp
+constexpr size_t longKeyLength = 1024;
+
+constexpr auto isBlankOrBreak(char c) noexcept -> bool {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+//!\brief characters that are not printable (see yaml-cpp Exp::NotPrintable), the C1 controls are checked separately
+constexpr auto isNotPrintable(unsigned char c) noexcept -> bool {
+    return c <= 0x08 || c == 0x0B || c == 0x0C || (c >= 0x0E && c <= 0x1F) || c == 0x7F;
+}
+
+//!\brief number of bytes of an UTF-8 sequence indicated by its first byte, -1 for a continuation byte
+constexpr auto utf8Length(unsigned char c) noexcept -> int {
+    switch (c >> 4) {
+    case 12:
+    case 13: return 2;
+    case 14: return 3;
+    case 15: return 4;
+    default: return c < 0x80 ? 1 : -1;
+    }
+}
+
+/*!\brief decodes the next code point and advances `pos`
+ *
+ * Invalid sequences and code points are replaced by U+FFFD, identical to yaml-cpp.
+ */
+auto nextCodePoint(std::string_view str, size_t & pos) noexcept -> uint32_t {
+    constexpr uint32_t replacement = 0xFFFD;
+
+    auto lead = static_cast<unsigned char>(str[pos++]);
+    auto len  = utf8Length(lead);
+    if (len < 1) {
+        return replacement;
+    }
+    if (len == 1) {
+        return lead;
+    }
+    uint32_t codePoint = lead & ~(0xFFu << (7 - len));
+    for (--len; len > 0; --len, ++pos) {
+        if (pos == str.size() || (static_cast<unsigned char>(str[pos]) & 0xC0) != 0x80) {
+            return replacement;
+        }
+        codePoint = (codePoint << 6) | (static_cast<unsigned char>(str[pos]) & 0x3F);
+    }
+    if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF) || (codePoint & 0xFFFE) == 0xFFFE
+        || (codePoint >= 0xFDD0 && codePoint <= 0xFDEF)) {
+        return replacement;
+    }
+    return codePoint;
+}
+
+void appendUTF8(std::string & out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        out += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+//!\brief writes '\x..', '\u....' or '\U........' (the odd boundaries are the ones of yaml-cpp)
+void appendEscapeSequence(std::string & out, uint32_t codePoint) {
+    constexpr char hexDigits[] = "0123456789abcdef";
+
+    auto digits = 8;
+    if (codePoint < 0xFF) {
+        out += "\\x";
+        digits = 2;
+    } else if (codePoint < 0xFFFF) {
+        out += "\\u";
+        digits = 4;
+    } else {
+        out += "\\U";
+    }
+    for (; digits > 0; --digits) {
+        out += hexDigits[(codePoint >> (4 * (digits - 1))) & 0xF];
+    }
+}
+
+} // namespace
+
+auto isPlainYAML(std::string_view str) noexcept -> bool {
+    if (str.empty() || str == "~" || str == "null" || str == "Null" || str == "NULL") {
+        return false;
+    }
+
+    // start of a plain scalar
+    auto first = str[0];
+    auto second = str.size() > 1 ? str[1] : ' ';
+    if (isBlankOrBreak(first) || std::string_view{",[]{}#&*!|>'\"%@`"}.find(first) != std::string_view::npos) {
+        return false;
+    }
+    if ((first == '-' || first == '?' || first == ':') && isBlankOrBreak(second)) {
+        return false;
+    }
+
+    // trailing spaces would be lost
+    if (str.back() == ' ') {
+        return false;
+    }
+
+    for (size_t i{0}; i < str.size(); ++i) {
+        auto c    = static_cast<unsigned char>(str[i]);
+        auto next = i + 1 < str.size() ? static_cast<unsigned char>(str[i + 1]) : '\0';
+        if (c == '\t' || c == '\n' || c == '\r' || c == '&' || isNotPrintable(c)) {
+            return false;
+        }
+        if (c == ':' && (next == '\0' || isBlankOrBreak(next))) {
+            return false;
+        }
+        if (c == ' ' && next == '#') {
+            return false;
+        }
+        if (c == 0xC2 && ((next >= 0x80 && next <= 0x84) || (next >= 0x86 && next <= 0x9F))) {
+            return false;
+        }
+        if (c == 0xEF && str.substr(i, 3) == "\xEF\xBB\xBF") {
+            return false;
+        }
+    }
+    return true;
+}
+
+void appendDoubleQuotedYAML(std::string & out, std::string_view str) {
+    out += '"';
+    for (size_t pos{0}; pos < str.size();) {
+        auto codePoint = nextCodePoint(str, pos);
+        switch (codePoint) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        case '\r': out += "\\r"; break;
+        case '\b': out += "\\b"; break;
+        case '\f': out += "\\f"; break;
+        default:
+            // control characters, non breaking space and byte order marks are escaped
+            if (codePoint < 0x20 || (codePoint >= 0x80 && codePoint <= 0xA0) || codePoint == 0xFEFF) {
+                appendEscapeSequence(out, codePoint);
+            } else {
+                appendUTF8(out, codePoint);
+            }
+        }
+    }
+    out += '"';
+}
+
+void YAMLWriter::beginMap() {
+    beginGroup(/*.isMap=*/true);
+}
+
+void YAMLWriter::endMap() {
+    assert(!groups.empty() && groups.back().isMap);
+    endGroup();
+}
+
+void YAMLWriter::beginSeq() {
+    beginGroup(/*.isMap=*/false);
+}
+
+void YAMLWriter::endSeq() {
+    assert(!groups.empty() && !groups.back().isMap);
+    endGroup();
+}
+
+void YAMLWriter::key(std::string_view str) {
+    assert(!groups.empty() && groups.back().isMap);
+    beginEntry();
+    if (str.size() > longKeyLength) {
+        out += "? ";
+        writeScalar(str);
+        newline(groups.back().indent);
+        out += ':';
+        next = Context::LongKeyValue;
+    } else {
+        writeScalar(str);
+        out += ':';
+        next = Context::MapValue;
+    }
+}
+
+void YAMLWriter::string(std::string_view str) {
+    if (!groups.empty() && !groups.back().isMap) {
+        beginEntry();
+        out += '-';
+        next = Context::SeqItem;
+    }
+    if (next != Context::Root) {
+        out += ' ';
+    }
+    writeScalar(str);
+}
+
+void YAMLWriter::beginGroup(bool isMap) {
+    if (!groups.empty() && !groups.back().isMap) {
+        beginEntry();
+        out += '-';
+        next = Context::SeqItem;
+    }
+    auto indent = groups.empty() ? size_t{0} : groups.back().indent + 2;
+    groups.push_back({isMap, next, indent});
+}
+
+void YAMLWriter::endGroup() {
+    auto group = groups.back();
+    groups.pop_back();
+    if (group.count > 0) {
+        return;
+    }
+
+    // empty collections are written in flow style
+    if (group.context == Context::MapValue || (group.context == Context::SeqItem && !group.isMap)) {
+        newline(group.indent);
+    } else if (group.context != Context::Root) {
+        out += ' ';
+    }
+    out += group.isMap ? "{}" : "[]";
+}
+
+//!\brief separates a new entry from the previous one, or the first entry from the start of its collection
+void YAMLWriter::beginEntry() {
+    auto & group = groups.back();
+    if (group.count++ > 0) {
+        newline(group.indent);
+        return;
+    }
+    switch (group.context) {
+    case Context::Root: break;
+    case Context::MapValue: newline(group.indent); break;
+    case Context::SeqItem:
+        // a map continues in the line of its '-', a sequence starts below
+        if (group.isMap) {
+            out += ' ';
+        } else {
+            newline(group.indent);
+        }
+        break;
+    case Context::LongKeyValue: out += ' '; break;
+    }
+}
+
+void YAMLWriter::newline(size_t indent) {
+    out += '\n';
+    out.append(indent, ' ');
+}
+
+void YAMLWriter::writeScalar(std::string_view str) {
+    if (isPlainYAML(str)) {
+        out += str;
+    } else {
+        appendDoubleQuotedYAML(out, str);
+    }
+}
+
+} // namespace tdl::detail
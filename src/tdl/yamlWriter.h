@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tdl::detail {
+
+/*!\brief writes a YAML document event by event into a string
+ *
+ * Produces the same block style text as `YAML::Emitter` with default settings would produce for the equivalent
+ * YAML::Node tree, without building such a tree first. Strings are written plain if possible, otherwise double
+ * quoted. The document has no trailing newline.
+ *
+ * The choice between plain and quoted strings follows the emitter of the yaml-cpp version pinned by
+ * `TDL_YAML_CPP_VERSION` (0.8.0). Other yaml-cpp versions quote some strings differently, the text then differs
+ * from `YAML::Emitter`, but both are read back as the same document.
+ *
+ * A map expects alternating `key()` and value calls, a value is either a scalar or a nested collection.
+ */
+class YAMLWriter {
+public:
+    explicit YAMLWriter(std::string & out) : out{out} {}
+
+    void beginMap();
+    void endMap();
+    void beginSeq();
+    void endSeq();
+
+    //!\brief key of the next map entry
+    void key(std::string_view str);
+
+    //!\brief a string value
+    void string(std::string_view str);
+
+    //!\brief `.nan`, `.inf` and `-.inf` are numbers in YAML
+    static constexpr bool nonFiniteNumbers = true;
+
+    //!\brief a value that is not a string (number, bool), yaml-cpp writes these like strings
+    void scalar(std::string_view str) {
+        string(str);
+    }
+
+private:
+    //!\brief the position a node is written to
+    enum class Context : uint8_t {
+        Root,         //!< top level node of the document
+        MapValue,     //!< value after 'key:'
+        SeqItem,      //!< item after '-'
+        LongKeyValue, //!< value after a long key, written as '? key' followed by ':'
+    };
+
+    struct Group {
+        bool     isMap;
+        Context  context; //!< position of the collection itself
+        size_t   indent;  //!< column of the entries
+        uint32_t count{}; //!< number of started entries
+    };
+
+    std::string &      out;
+    std::vector<Group> groups{};
+    Context            next{Context::Root}; //!< position of the next node
+
+    void beginGroup(bool isMap);
+    void endGroup();
+    void beginEntry();
+    void newline(size_t indent);
+    void writeScalar(std::string_view str);
+};
+
+//!\brief true if `str` is written without quotes by the YAML emitter
+auto isPlainYAML(std::string_view str) noexcept -> bool;
+
+//!\brief appends `str` as double quoted YAML string, escaped the same way as yaml-cpp does
+void appendDoubleQuotedYAML(std::string & out, std::string_view str);
+
+} // namespace tdl::detail
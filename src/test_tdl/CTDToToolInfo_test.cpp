@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "utils.h"
+
+namespace {
+auto richToolInfo() -> tdl::ToolInfo {
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){
+            DESINIT(.version =) "7.6.5",
+            DESINIT(.name =) "testApp",
+            DESINIT(.docurl =) "example.com?a=1&b=2",
+            DESINIT(.category =) "test-category",
+            DESINIT(.description =) "a <demonstration> & more\nwith two lines",
+            DESINIT(.executableName =) "test",
+            DESINIT(.citations =){{"doi:123", "https://en.wikipedia.org/wiki/Meaning_of_life"},
+                                  {"doi:456", "https://example.com"}},
+        },
+        DESINIT(.params =){
+            {DESINIT(.name =) "bool", DESINIT(.description =) "", DESINIT(.tags =){"advanced"}, DESINIT(.value =) true},
+            {DESINIT(.name =) "int",
+             DESINIT(.description =) "an \"int\"\twith 'quotes'",
+             DESINIT(.tags =){"required", "zeta", "alpha"},
+             DESINIT(.value =) tdl::IntValue{-5, -10, 9}},
+            {DESINIT(.name =) "double",
+             DESINIT(.description =) "line\nbreak",
+             DESINIT(.tags =){},
+             DESINIT(.value =) tdl::DoubleValue{0.1, std::nullopt, 1.25}},
+            {DESINIT(.name =) "string",
+             DESINIT(.description =) "",
+             DESINIT(.tags =){"output prefix", "required"},
+             DESINIT(.value =) tdl::StringValue{"out <&>", {{"a", "b"}}}},
+            {DESINIT(.name =) "choice",
+             DESINIT(.description =) "",
+             DESINIT(.tags =){},
+             DESINIT(.value =) tdl::StringValue{"x", {{"x", "y", "z"}}}},
+            {DESINIT(.name =) "node",
+             DESINIT(.description =) "a node",
+             DESINIT(.tags =){"required", "advanced", "other"},
+             DESINIT(.value =) tdl::Node::Children{
+                 {DESINIT(.name =) "ints",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::IntValueList{{1, 2}, 0, 5}},
+                 {DESINIT(.name =) "doubles",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::DoubleValueList{{1.5, 1e-9}}},
+                 {DESINIT(.name =) "strings",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){"input file"},
+                  DESINIT(.value =) tdl::StringValueList{{"a.fa", "b.fa"}, {{"fa", "fasta"}}}},
+                 {DESINIT(.name =) "outputs",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){"output file"},
+                  DESINIT(.value =) tdl::StringValueList{{}, std::nullopt}},
+                 {DESINIT(.name =) "empty",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::Node::Children{}},
+             }},
+        },
+        DESINIT(.cliMapping =){{DESINIT(.optionIdentifier =) "--int", DESINIT(.referenceName =) "int"},
+                               {DESINIT(.optionIdentifier =) "-d", DESINIT(.referenceName =) "node:doubles"}}};
+}
+
+auto throws(std::string_view ctd) -> bool {
+    try {
+        tdl::parseCTD(ctd);
+    } catch (std::runtime_error const &) {
+        return true;
+    }
+    return false;
+}
+} // namespace
+
+void testParseCTDRoundTrip() {
+    auto ctd = convertToCTD(richToolInfo());
+    auto doc = tdl::parseCTD(ctd);
+
+    // parseCTD is the inverse of convertToCTD
+    assert(convertToCTD(doc) == ctd);
+
+    auto const & meta = doc.metaInfo;
+    assert(meta.version == "7.6.5");
+    assert(meta.name == "testApp");
+    assert(meta.docurl == "example.com?a=1&b=2");
+    assert(meta.category == "test-category");
+    assert(meta.description == "a <demonstration> & more\nwith two lines");
+    assert(meta.executableName == "test");
+    assert(meta.citations.size() == 2);
+    assert(meta.citations[1].doi == "doi:456");
+    assert(meta.citations[1].url == "https://example.com");
+
+    assert(doc.params.size() == 6);
+    assert(std::get<tdl::BoolValue>(doc.params[0].value) == true);
+    assert(doc.params[0].tags == tdl::Tags{"advanced"});
+
+    auto const & intValue = std::get<tdl::IntValue>(doc.params[1].value);
+    assert(doc.params[1].description == "an \"int\"\twith 'quotes'");
+    assert(doc.params[1].tags == (tdl::Tags{"required", "zeta", "alpha"}));
+    assert(intValue.value == -5 && intValue.minLimit == -10 && intValue.maxLimit == 9);
+
+    auto const & doubleValue = std::get<tdl::DoubleValue>(doc.params[2].value);
+    assert(doc.params[2].description == "line\nbreak");
+    assert(doubleValue.value == 0.1 && !doubleValue.minLimit && doubleValue.maxLimit == 1.25);
+
+    auto const & stringValue = std::get<tdl::StringValue>(doc.params[3].value);
+    assert(doc.params[3].tags == (tdl::Tags{"output prefix", "required"}));
+    assert(stringValue.value == "out <&>");
+    assert(stringValue.validValues == (std::vector<std::string>{"a", "b"}));
+
+    auto const & choice = std::get<tdl::StringValue>(doc.params[4].value);
+    assert(doc.params[4].tags.empty());
+    assert(choice.validValues == (std::vector<std::string>{"x", "y", "z"}));
+
+    auto const & children = std::get<tdl::Node::Children>(doc.params[5].value);
+    assert(doc.params[5].tags == (tdl::Tags{"required", "advanced", "other"}));
+    assert(children.size() == 5);
+    assert(std::get<tdl::IntValueList>(children[0].value).value == (std::vector<int>{1, 2}));
+    assert(std::get<tdl::IntValueList>(children[0].value).maxLimit == 5);
+    assert(std::get<tdl::DoubleValueList>(children[1].value).value == (std::vector<double>{1.5, 1e-9}));
+    assert(children[2].tags == tdl::Tags{"input file"});
+    assert(std::get<tdl::StringValueList>(children[2].value).value == (std::vector<std::string>{"a.fa", "b.fa"}));
+    assert(std::get<tdl::StringValueList>(children[2].value).validValues
+           == (std::vector<std::string>{"fa", "fasta"}));
+    assert(children[3].tags == tdl::Tags{"output file"});
+    assert(std::get<tdl::StringValueList>(children[3].value).value.empty());
+    assert(std::get<tdl::Node::Children>(children[4].value).empty());
+
+    assert(doc.cliMapping.size() == 2);
+    assert(doc.cliMapping[1].optionIdentifier == "-d");
+    assert(doc.cliMapping[1].referenceName == "node:doubles");
+}
+
+void testParseCTDHandwritten() {
+    // formatting that is not produced by convertToCTD, but is valid XML
+    auto ctd = std::string_view{R"(<?xml version="1.0" encoding="UTF-8"?>
+<!-- a comment -->
+<tool ctdVersion='1.7' name="app" >
+    <description>plain &amp; escaped</description>
+    <unknown><nested attr="1"/></unknown>
+    <PARAMETERS>
+        <ITEM name = "x" value="1e+05" type="double" restrictions=":" />
+        <ITEM name="y" value="+3" type="int" restrictions="-1:" description="with &#x41;&#66;#br#"></ITEM>
+        <ITEMLIST name="z" type="string">
+            <!-- comment inside a list -->
+            <LISTITEM value="a"/>
+        </ITEMLIST>
+    </PARAMETERS>
+</tool>
+)"};
+
+    auto doc = tdl::parseCTD(ctd);
+    assert(doc.metaInfo.name == "app");
+    assert(doc.metaInfo.description == "plain & escaped");
+    assert(doc.params.size() == 3);
+    assert(std::get<tdl::DoubleValue>(doc.params[0].value).value == 100000.);
+    assert(!std::get<tdl::DoubleValue>(doc.params[0].value).minLimit);
+    assert(std::get<tdl::IntValue>(doc.params[1].value).value == 3);
+    assert(std::get<tdl::IntValue>(doc.params[1].value).minLimit == -1);
+    assert(doc.params[1].description == "with AB\n");
+    assert(std::get<tdl::StringValueList>(doc.params[2].value).value == std::vector<std::string>{"a"});
+}
+
+void testParseCTDErrors() {
+    assert(throws(""));
+    assert(throws("<notATool/>"));
+    assert(throws("<tool>"));
+    assert(throws("<tool><PARAMETERS></tool>"));
+    assert(throws("<tool name=\"unterminated/>"));
+    assert(throws("<tool name=unquoted/>"));
+    assert(throws("<tool/><tool/>"));
+    assert(throws(R"(<tool><PARAMETERS><ITEM name="x" value="abc" type="int"/></PARAMETERS></tool>)"));
+    assert(throws(R"(<tool><PARAMETERS><ITEM name="x" value="1" type="int" restrictions="5"/></PARAMETERS></tool>)"));
+    assert(throws(R"(<tool><PARAMETERS><ITEM name="x" value="yes" type="bool"/></PARAMETERS></tool>)"));
+    assert(throws(R"(<tool><PARAMETERS><ITEM name="x" value="1" type="complex"/></PARAMETERS></tool>)"));
+    assert(!throws("<tool/>"));
+}
+
+void testLoadCTD() {
+    auto directory = std::filesystem::temp_directory_path() / "tdl_test_load_ctd";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    auto writeFile = [&](std::string const & name, std::string const & content) {
+        auto file = std::ofstream{directory / name, std::ios::binary};
+        file << content;
+    };
+
+    auto doc  = richToolInfo();
+    auto ctd1 = convertToCTD(doc);
+
+    doc.metaInfo.name = "secondApp";
+    auto ctd2         = convertToCTD(doc);
+
+    writeFile("b.ctd", ctd2);
+    writeFile("a.ctd", ctd1);
+    writeFile("ignored.txt", "not a ctd file");
+    std::filesystem::create_directories(directory / "subdir.ctd");
+
+    { // single file
+        auto loaded = tdl::loadCTD(directory / "a.ctd");
+        assert(convertToCTD(loaded) == ctd1);
+    }
+
+    { // whole directory, sorted by file name
+        auto loaded = tdl::loadCTDDirectory(directory);
+        assert(loaded.size() == 2);
+        assert(convertToCTD(loaded[0]) == ctd1);
+        assert(convertToCTD(loaded[1]) == ctd2);
+    }
+
+    { // errors contain the file name
+        writeFile("broken.ctd", "<tool>");
+        writeFile("empty.ctd", "");
+        for (auto name : {"broken.ctd", "empty.ctd", "missing.ctd"}) {
+            try {
+                tdl::loadCTD(directory / name);
+                assert(false);
+            } catch (std::runtime_error const & e) {
+                assert(std::string_view{e.what()}.find(name) != std::string_view::npos);
+            }
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+void testParseCTD() {
+    testParseCTDRoundTrip();
+    testParseCTDHandwritten();
+    testParseCTDErrors();
+    testLoadCTD();
+}
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils.h"
+
+void testTags() {
+    // the names of the well-known tags must be sorted, iteration relies on it
+    assert(std::is_sorted(tdl::Tags::names.begin(), tdl::Tags::names.end()));
+    assert(tdl::Tags::knownTag("input file") == tdl::Tag::input_file);
+    assert(!tdl::Tags::knownTag("input"));
+
+    { // construction and lookup
+        auto tags = tdl::Tags{"zeta", "required", "alpha", "input file", "required"};
+        assert(tags.size() == 4);
+        assert(!tags.empty());
+        assert(tags.count("required") == 1);
+        assert(tags.count(tdl::Tag::required) == 1);
+        assert(tags.count(tdl::Tag::input_file) == 1);
+        assert(tags.count("zeta") == 1);
+        assert(tags.count("advanced") == 0);
+        assert(tags.count("beta") == 0);
+        assert(tdl::Tags{}.empty());
+    }
+
+    { // find returns an iterator, like std::set<std::string>
+        auto tags = tdl::Tags{"zeta", "required", "alpha", "input file", "output", "output files"};
+        assert(*tags.find("alpha") == "alpha");
+        assert(*tags.find(tdl::Tag::output) == "output");
+        assert(*std::next(tags.find("output")) == "output files");
+        assert(*std::next(tags.find("output files")) == "required");
+        assert(std::next(tags.find("zeta")) == tags.end());
+        assert(tags.find("alpha") == tags.begin());
+        assert(tags.find("beta") == tags.end());
+        assert(tags.find(tdl::Tag::advanced) == tags.end());
+        for (auto iter = tags.begin(); iter != tags.end(); ++iter) {
+            assert(tags.find(*iter) == iter);
+        }
+    }
+
+    { // iteration yields all tags sorted, like std::set<std::string>
+        auto tags   = tdl::Tags{"zeta", "required", "alpha", "input file", "output", "output files"};
+        auto values = std::vector<std::string>{};
+        for (auto const & t : tags) {
+            values.emplace_back(t);
+        }
+        assert((values
+                == std::vector<std::string>{"alpha", "input file", "output", "output files", "required", "zeta"}));
+        assert(std::distance(tags.begin(), tags.end()) == 6);
+    }
+
+    { // insert and erase
+        auto tags = tdl::Tags{};
+        assert(tags.insert("advanced").second);
+        assert(!tags.insert(tdl::Tag::advanced).second);
+        auto [iter, inserted] = tags.insert("custom");
+        assert(inserted && *iter == "custom" && iter == tags.find("custom"));
+        assert(tags.insert(std::string{"custom"}) == std::make_pair(iter, false));
+        assert(*tags.insert("beta").first == "beta");
+        assert(tags.erase("beta") == 1);
+        assert(tags.size() == 2);
+        assert(tags.erase("custom") == 1);
+        assert(tags.erase("custom") == 0);
+        assert(tags.erase(tdl::Tag::advanced) == 1);
+        assert(tags.erase("advanced") == 0);
+        assert(tags.empty());
+        assert(tags.begin() == tags.end());
+    }
+
+    { // comparison
+        auto tags = tdl::Tags{"file", "b", "a"};
+        auto copy = tags;
+        assert(copy == (tdl::Tags{"a", "b", "file"}));
+        copy.erase("b");
+        assert(copy != tags);
+        copy.clear();
+        assert(copy == tdl::Tags{});
+    }
+}
@@ -2,6 +2,8 @@
 // SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
 // SPDX-License-Identifier: CC0-1.0
 
+#include <sstream>
+
 #include "utils.h"
 
 void testToolInfo() {
@@ -589,6 +591,112 @@ void testCliMapping() {
     }
 }
 
+void testStreaming() {
+    auto doc = tdl::ToolInfo{
+        DESINIT(.metaInfo =){DESINIT(.version =) "1.0", DESINIT(.name =) "testApp"},
+        DESINIT(.params =){{DESINIT(.name =) "foo",
+                            DESINIT(.description =) "testing streaming output",
+                            DESINIT(.tags =){},
+                            DESINIT(.value =) tdl::Node::Children{{DESINIT(.name =) "bar",
+                                                                   DESINIT(.description =) "",
+                                                                   DESINIT(.tags =){"required"},
+                                                                   DESINIT(.value =) tdl::IntValueList{{1, 2, 3}}}}}},
+        DESINIT(.cliMapping =){{DESINIT(.optionIdentifier =) "--bar", DESINIT(.referenceName =) "foo:bar"}}};
+
+    auto expected = convertToCTD(doc);
+
+    { // Writing into an output stream
+        auto ss = std::stringstream{};
+        convertToCTD(doc, ss);
+        assert(expected == ss.str());
+    }
+
+    { // Appending to a string buffer keeps the existing content
+        auto buffer = std::string{"prefix"};
+        convertToCTD(doc, buffer);
+        assert("prefix" + expected == buffer);
+    }
+}
+
+void testXMLNodeTree() {
+    // The direct writer must produce the same document as the intermediate XMLNode tree
+    auto doc = tdl::ToolInfo{
+        DESINIT(.metaInfo =){
+            DESINIT(.version =) "7.6.5",
+            DESINIT(.name =) "testApp",
+            DESINIT(.docurl =) "example.com",
+            DESINIT(.category =) "test-category",
+            DESINIT(.description =) "a <demonstration> & more",
+            DESINIT(.executableName =) "test",
+            DESINIT(.citations =){{"doi:123", "https://en.wikipedia.org/wiki/Meaning_of_life"}},
+        },
+        DESINIT(.params =){
+            {DESINIT(.name =) "bool", DESINIT(.description =) "", DESINIT(.tags =){"advanced"}, DESINIT(.value =) true},
+            {DESINIT(.name =) "int",
+             DESINIT(.description =) "an \"int\"",
+             DESINIT(.tags =){"required", "zeta", "alpha"},
+             DESINIT(.value =) tdl::IntValue{5, 1, 9}},
+            {DESINIT(.name =) "double",
+             DESINIT(.description =) "line\nbreak",
+             DESINIT(.tags =){},
+             DESINIT(.value =) tdl::DoubleValue{0.5, std::nullopt, 1.25}},
+            {DESINIT(.name =) "string",
+             DESINIT(.description =) "",
+             DESINIT(.tags =){"output prefix", "required"},
+             DESINIT(.value =) tdl::StringValue{"out", {{"a", "b"}}}},
+            {DESINIT(.name =) "node",
+             DESINIT(.description =) "a node",
+             DESINIT(.tags =){"required", "advanced", "other"},
+             DESINIT(.value =) tdl::Node::Children{
+                 {DESINIT(.name =) "ints",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::IntValueList{{1, 2}, 0, 5}},
+                 {DESINIT(.name =) "doubles",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::DoubleValueList{{1.5}}},
+                 {DESINIT(.name =) "strings",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){"input file"},
+                  DESINIT(.value =) tdl::StringValueList{{"a.fa", "b.fa"}, {{"fa", "fasta"}}}},
+                 {DESINIT(.name =) "empty",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::Node::Children{}},
+             }},
+        },
+        DESINIT(.cliMapping =){{DESINIT(.optionIdentifier =) "--int", DESINIT(.referenceName =) "int"}}};
+
+    auto expected = std::string{tdl::detail::ctdHeader} + tdl::detail::convertToXMLNode(doc).generateString(
+                                                                tdl::detail::ctdAttributeOrder);
+    auto output = convertToCTD(doc);
+    assert(output.size() == expected.size());
+    assert(expected == output);
+}
+
+void testAttributeOrder() {
+    auto node = tdl::detail::XMLNode{
+        DESINIT(.tag =) "n",
+        DESINIT(.attr =){{"d", "4"}, {"c", "3"}, {"b", std::nullopt}, {"a", "1"}},
+    };
+
+    // listed keys first, remaining keys alphabetically, duplicated keys are ignored
+    auto order = tdl::detail::AttributeOrder{"c", "x", "b", "c"};
+    assert(order.size() == 3);
+    assert(order.rank("c") == 0);
+    assert(order.rank("x") == 1);
+    assert(order.rank("b") == 2);
+    assert(order.rank("a") == 3);
+    assert(node.generateString(order) == "<n c=\"3\" b a=\"1\" d=\"4\" />\n");
+    assert(node.generateString({}) == "<n a=\"1\" b c=\"3\" d=\"4\" />\n");
+
+    // the same compiled order can be reused for many nodes
+    auto vectorOrder = tdl::detail::AttributeOrder{std::vector<std::string>{"d", "a"}};
+    assert(node.generateString(vectorOrder) == "<n d=\"4\" a=\"1\" b c=\"3\" />\n");
+    assert(node.generateString(vectorOrder) == "<n d=\"4\" a=\"1\" b c=\"3\" />\n");
+}
+
 void testCTD() {
     testToolInfo();
     testNodeSingleInt();
@@ -597,4 +705,7 @@ void testCTD() {
     testNodeNestedTypes();
     testNodeTags();
     testCliMapping();
+    testStreaming();
+    testXMLNodeTree();
+    testAttributeOrder();
 }
@@ -2,7 +2,16 @@
 // SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
 // SPDX-License-Identifier: CC0-1.0
 
+#include <cmath>
+#include <limits>
+#include <random>
+#include <thread>
+
+#include <tdl/yamlWriter.h>
+#include <yaml-cpp/yaml.h>
+
 #include "utils.h"
+#include "yamlUtils.h"
 
 namespace cwl_tests {
 
@@ -322,8 +331,239 @@ baseCommand:
     }
 }
 
+void testOptions() {
+    auto doc = tdl::ToolInfo{};
+
+    doc.metaInfo.name           = "tool";
+    doc.metaInfo.executableName = "tool";
+
+    { // hooks are applied in order
+        auto options = tdl::CWLOptions{};
+        options.hooks.push_back([](YAML::Node & node) {
+            node["id"] = "first";
+        });
+        options.hooks.push_back([](YAML::Node & node) {
+            node["id"] = node["id"].Scalar() + "-second";
+        });
+        auto output = convertToCWL(doc, options);
+        assert(output.find("id: first-second") != std::string::npos);
+    }
+
+    { // the global callback is only used without options
+        tdl::post_process_cwl = [](YAML::Node & node) {
+            node["id"] = "global";
+        };
+        assert(convertToCWL(doc).find("id: global") != std::string::npos);
+        assert(convertToCWL(doc, {}).find("id:") == std::string::npos);
+        tdl::post_process_cwl = nullptr;
+        assert(convertToCWL(doc) == convertToCWL(doc, {}));
+    }
+
+    { // concurrent conversions with different options do not interfere
+        auto threads = std::vector<std::thread>{};
+        auto outputs = std::vector<std::string>(8);
+        for (size_t i{0}; i < outputs.size(); ++i) {
+            threads.emplace_back([&, i]() {
+                auto options = tdl::CWLOptions{};
+                options.hooks.push_back([i](YAML::Node & node) {
+                    node["id"] = "tool" + std::to_string(i);
+                });
+                for (size_t j{0}; j < 20; ++j) {
+                    outputs[i] = convertToCWL(doc, options);
+                }
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+        for (size_t i{0}; i < outputs.size(); ++i) {
+            auto expected = "\nid: tool" + std::to_string(i); // last entry of the document
+            assert(outputs[i].size() > expected.size());
+            assert(outputs[i].substr(outputs[i].size() - expected.size()) == expected);
+        }
+    }
+}
+
+/*!\brief the direct writer must produce the same document as the reference path through YAML::Node
+ *
+ * The parsed documents are compared, not the text. Quoting differs between yaml-cpp versions, a string
+ * that is quoted by one and plain in the other is still the same string.
+ */
+void checkDirectWriter(tdl::ToolInfo const & doc) {
+    auto direct    = convertToCWL(doc, {});
+    auto reference = tdl::detail::convertToCWLReference(doc, {});
+    auto equal     = equalNodes(YAML::Load(direct), YAML::Load(reference));
+    if (!equal) {
+        std::cerr << "direct:\n" << direct << "\nreference:\n" << reference << '\n';
+    }
+    assert(equal);
+}
+
+auto randomToolInfo(std::mt19937 & rng) -> tdl::ToolInfo {
+    auto const strings = std::vector<std::string>{
+        "", "a", "tool name", "null", "true", "-", "-x", "a: b", "a #b", "#a", "&a", "a&b", "*a", "\"a\"", "a\nb",
+        "a\tb", "trailing ", " leading", "ünïcödé", "\xef\xbb\xbf", "\xff", "C:\\path", "$(inputs.x)", "[1, 2]", "{}"};
+    auto const tags = std::vector<std::string>{
+        "required", "no_default", "default_as_hint", "output", "file", "directory", "prefixed", "basecommand"};
+    auto const doubles = std::vector<double>{0.,
+                                             1.5,
+                                             -2.,
+                                             1e20,
+                                             1e-7,
+                                             std::numeric_limits<double>::infinity(),
+                                             -std::numeric_limits<double>::infinity(),
+                                             std::numeric_limits<double>::quiet_NaN()};
+
+    auto pick = [&](auto const & list) {
+        return list[rng() % list.size()];
+    };
+
+    auto doc = tdl::ToolInfo{};
+    doc.metaInfo.name           = pick(strings);
+    doc.metaInfo.description    = pick(strings);
+    doc.metaInfo.executableName = "bin/" + pick(strings);
+
+    auto names = std::vector<std::string>{};
+    auto makeChildren = [&](auto & self, size_t depth) -> tdl::Node::Children {
+        auto children = tdl::Node::Children{};
+        auto count    = rng() % 5;
+        for (size_t i{0}; i < count; ++i) {
+            auto node = tdl::Node{};
+            // reused names check that duplicates replace earlier entries
+            auto newName     = rng() % 4 == 0 || names.empty();
+            node.name        = newName ? pick(strings) + std::to_string(names.size()) : pick(names);
+            node.description = pick(strings);
+            for (auto const & tag : tags) {
+                if (rng() % 4 == 0) {
+                    node.tags.insert(tag);
+                }
+            }
+            switch (depth > 0 ? rng() % 8 : rng() % 7) {
+            case 0: node.value = rng() % 2 == 0; break;
+            case 1: node.value = tdl::IntValue{static_cast<int>(rng() % 2000) - 1000}; break;
+            case 2: node.value = tdl::DoubleValue{pick(doubles)}; break;
+            case 3: node.value = tdl::StringValue{pick(strings)}; break;
+            case 4: node.value = tdl::IntValueList{{1, 2}}; break;
+            case 5: node.value = tdl::DoubleValueList{{1.5}}; break;
+            case 6: node.value = tdl::StringValueList{{pick(strings)}}; break;
+            default: node.value = self(self, depth - 1);
+            }
+            if (newName && rng() % 2 == 0) {
+                doc.cliMapping.push_back({"--" + node.name, node.name});
+            }
+            names.push_back(node.name);
+            children.push_back(std::move(node));
+        }
+        return children;
+    };
+    doc.params = makeChildren(makeChildren, 7);
+    return doc;
+}
+
+void testDirectWriter() {
+    { // the YAML writer itself
+        auto out    = std::string{};
+        auto writer = tdl::detail::YAMLWriter{out};
+        writer.beginMap();
+        writer.key("empty");
+        writer.beginSeq();
+        writer.endSeq();
+        writer.key("list");
+        writer.beginSeq();
+        writer.beginMap();
+        writer.key("a");
+        writer.string("null");
+        writer.key("b");
+        writer.scalar("1.5");
+        writer.endMap();
+        writer.beginMap();
+        writer.endMap();
+        writer.endSeq();
+        writer.key("a: b");
+        writer.string("line\nbreak");
+        writer.endMap();
+        assert(out == "empty:\n  []\nlist:\n  - a: \"null\"\n    b: 1.5\n  - {}\n\"a: b\": \"line\\nbreak\"");
+    }
+
+    { // records, nested deeper than the supported depth
+        auto doc                    = tdl::ToolInfo{};
+        doc.metaInfo.executableName = "tool";
+        auto leaf                   = tdl::Node{"leaf", "a leaf", {"required"}, tdl::DoubleValue{0.25}};
+        for (size_t i{0}; i < 7; ++i) {
+            auto parent = tdl::Node{"level" + std::to_string(i), "a record", {}, tdl::Node::Children{leaf}};
+            if (i % 2 == 0) {
+                parent.tags.insert("required");
+            }
+            leaf = parent;
+        }
+        doc.params = {leaf, tdl::Node{"empty", "", {}, tdl::Node::Children{}}};
+        checkDirectWriter(doc);
+    }
+
+    { // values, strings and duplicate names that require special handling
+        auto doc                    = tdl::ToolInfo{};
+        doc.metaInfo.name           = "null";
+        doc.metaInfo.description    = "multi\nline: description # with comment";
+        doc.metaInfo.executableName = "/usr/bin/tool";
+        doc.params = {
+            tdl::Node{"d1", "", {}, tdl::DoubleValue{1e20}},
+            tdl::Node{"d2", "", {}, tdl::DoubleValue{std::numeric_limits<double>::quiet_NaN()}},
+            tdl::Node{"d3", "", {}, tdl::DoubleValue{-std::numeric_limits<double>::infinity()}},
+            tdl::Node{"s1", "", {}, tdl::StringValue{"true"}},
+            tdl::Node{"s2", "", {}, tdl::StringValue{""}},
+            tdl::Node{"s3", "", {"file"}, tdl::StringValue{"in.fa"}},
+            tdl::Node{"out", "", {"output", "prefixed"}, tdl::StringValueList{}},
+            tdl::Node{"d1", "replaces the first d1", {"required"}, tdl::BoolValue{true}},
+            tdl::Node{"-", "- a: b", {}, tdl::StringValue{"&anchor"}},
+        };
+        doc.cliMapping = {{"--d1", "d1"}, {"-", "-"}};
+        checkDirectWriter(doc);
+    }
+
+    { // referenceNames must be unique
+        auto doc       = tdl::ToolInfo{};
+        doc.params     = {tdl::Node{"a", "", {}, tdl::IntValue{}}};
+        doc.cliMapping = {{"-a", "a"}, {"--a", "a"}};
+        for (auto direct : {true, false}) {
+            try {
+                direct ? convertToCWL(doc, {}) : tdl::detail::convertToCWLReference(doc, {});
+                assert(false);
+            } catch (std::runtime_error const & e) {
+                assert(std::string{e.what()}.find("'a'") != std::string::npos);
+            }
+        }
+    }
+
+    { // mappings are found independent of their order, mappings without parameter are ignored
+        auto doc   = tdl::ToolInfo{};
+        auto names = std::vector<std::string>{};
+        for (size_t i{0}; i < 200; ++i) {
+            names.push_back("param" + std::to_string(i));
+            doc.params.push_back(tdl::Node{names.back(), "", {}, tdl::IntValue{}});
+        }
+        for (auto iter = names.rbegin(); iter != names.rend(); ++iter) {
+            doc.cliMapping.push_back({"--" + *iter, *iter});
+        }
+        doc.cliMapping.push_back({"--unused", "unused"});
+        auto output = convertToCWL(doc, {});
+        assert(output.find("prefix: --param0\n") != std::string::npos);
+        assert(output.find("prefix: --param199\n") != std::string::npos);
+        assert(output.find("--unused") == std::string::npos);
+        checkDirectWriter(doc);
+    }
+
+    { // randomly generated documents
+        auto rng = std::mt19937{42};
+        for (size_t i{0}; i < 300; ++i) {
+            checkDirectWriter(randomToolInfo(rng));
+        }
+    }
+}
+
 } // namespace cwl_tests
 void testCWL() {
     cwl_tests::testToolInfo();
     cwl_tests::testComplexCall();
+    cwl_tests::testOptions();
+    cwl_tests::testDirectWriter();
 }
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <yaml-cpp/yaml.h>
+
+#include "utils.h"
+
+void testConversionCache() {
+    auto directory = std::filesystem::temp_directory_path()
+                     / ("tdl_conversion_cache_" + std::to_string(std::random_device{}()));
+
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "tool";
+    doc.metaInfo.version        = "1.0.0";
+    doc.metaInfo.executableName = "tool";
+    doc.params                  = {{"threads", "number of threads", {}, tdl::IntValue{4, 1, 64}}};
+    doc.cliMapping              = {{"--threads", "threads"}};
+
+    { // the second conversion is served from the cache
+        auto cache = tdl::ConversionCache{directory};
+        assert(tdl::convertToCTD(doc, cache) == tdl::convertToCTD(doc));
+        assert(tdl::convertToCTD(doc, cache) == tdl::convertToCTD(doc));
+        assert(tdl::convertToCWL(doc, {}, cache) == tdl::convertToCWL(doc, {}));
+        assert(tdl::convertToCWL(doc, {}, cache) == tdl::convertToCWL(doc, {}));
+        assert(cache.misses() == 2 && cache.hits() == 2);
+
+        // a changed tool is converted again
+        auto changed            = doc;
+        changed.params[0].value = tdl::IntValue{8, 1, 64};
+        assert(tdl::convertToCTD(changed, cache) == tdl::convertToCTD(changed));
+        assert(cache.misses() == 3);
+
+        auto entries = cache.entries();
+        assert(entries.size() == 3);
+        assert(entries[0].format == "ctd" && entries[1].format == "cwl");
+        assert(entries[0].toolName == "tool" && entries[0].toolVersion == "1.0.0");
+        assert(entries[0].key == tdl::ConversionCache::key(doc, "ctd"));
+        assert(cache.find(entries[1].key, "cwl") == tdl::convertToCWL(doc, {}));
+        assert(!cache.find(entries[1].key, "ctd"));
+    }
+
+    { // a new cache on the same directory finds the entries
+        auto cache = tdl::ConversionCache{directory};
+        assert(tdl::convertToCTD(doc, cache) == tdl::convertToCTD(doc));
+        assert(cache.hits() == 1 && cache.misses() == 0);
+    }
+
+    { // hooks are only cached with an id
+        auto cache   = tdl::ConversionCache{directory};
+        auto options = tdl::CWLOptions{};
+        options.hooks.push_back([](YAML::Node & node) { node["label"] = "with hook"; });
+
+        auto expected = tdl::convertToCWL(doc, options);
+        assert(tdl::convertToCWL(doc, options, cache) == expected);
+        assert(tdl::convertToCWL(doc, options, cache) == expected);
+        assert(cache.hits() == 0 && cache.misses() == 2);
+
+        options.hooksId = "label hook";
+        assert(tdl::convertToCWL(doc, options, cache) == expected);
+        assert(tdl::convertToCWL(doc, options, cache) == expected);
+        assert(cache.hits() == 1 && cache.misses() == 3);
+
+        // another id is another entry
+        options.hooksId = "label hook v2";
+        assert(tdl::convertToCWL(doc, options, cache) == expected);
+        assert(cache.hits() == 1 && cache.misses() == 4);
+        assert(tdl::ConversionCache::key(doc, "cwl", "a") != tdl::ConversionCache::key(doc, "cwl", "b"));
+    }
+
+    { // several threads writing the same entries
+        auto cache   = tdl::ConversionCache{directory / "shared"};
+        auto results = std::vector<std::string>(8);
+        auto threads = std::vector<std::thread>{};
+        for (size_t i{0}; i < results.size(); ++i) {
+            threads.emplace_back([&, i] {
+                auto changed            = doc;
+                changed.params[0].value = tdl::IntValue{static_cast<int>(i % 2), 0, 64};
+                results[i]              = tdl::convertToCTD(changed, cache);
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+        for (size_t i{0}; i < results.size(); ++i) {
+            assert(results[i] == results[i % 2]);
+        }
+        assert(cache.hits() + cache.misses() == results.size());
+
+        // no temporary files are left behind
+        for (auto const & entry : std::filesystem::directory_iterator{directory / "shared"}) {
+            assert(entry.path().extension() != ".tmp");
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <atomic>
+#include <stdexcept>
+
+#include <yaml-cpp/yaml.h>
+
+#include "utils.h"
+
+namespace {
+auto makeToolInfos(size_t count) -> std::vector<tdl::ToolInfo> {
+    auto docs = std::vector<tdl::ToolInfo>{};
+    for (size_t i{0}; i < count; ++i) {
+        auto doc                    = tdl::ToolInfo{};
+        doc.metaInfo.name           = "tool" + std::to_string(i);
+        doc.metaInfo.executableName = "tool" + std::to_string(i);
+        for (size_t j{0}; j < i % 7; ++j) {
+            auto name = "param" + std::to_string(j);
+            doc.params.push_back(tdl::Node{name, "a parameter", {}, tdl::IntValue{static_cast<int>(i * j)}});
+            doc.cliMapping.push_back({"--" + name, name});
+        }
+        docs.push_back(std::move(doc));
+    }
+    return docs;
+}
+} // namespace
+
+void testConvertAll() {
+    auto docs = makeToolInfos(100);
+
+    { // results are in input order and equal to the single document conversion
+        for (size_t threads : {0, 1, 3, 200}) {
+            auto results = tdl::convertAll(docs, tdl::Formats::All, {DESINIT(.threads =) threads});
+            assert(results.size() == docs.size());
+            for (size_t i{0}; i < docs.size(); ++i) {
+                assert(results[i].ctd == convertToCTD(docs[i]));
+                assert(results[i].cwl == convertToCWL(docs[i]));
+            }
+        }
+    }
+
+    { // only the requested formats are generated
+        auto results = tdl::convertAll(docs, tdl::Formats::CTD, {DESINIT(.threads =) 4});
+        for (size_t i{0}; i < docs.size(); ++i) {
+            assert(results[i].ctd == convertToCTD(docs[i]));
+            assert(results[i].cwl.empty());
+        }
+        results = tdl::convertAll(docs, tdl::Formats::CWL, {DESINIT(.threads =) 4});
+        for (size_t i{0}; i < docs.size(); ++i) {
+            assert(results[i].ctd.empty());
+            assert(results[i].cwl == convertToCWL(docs[i]));
+        }
+        assert(tdl::convertAll({}, tdl::Formats::All).empty());
+    }
+
+    { // post_process_cwl is called concurrently for every document
+        auto calls            = std::atomic<size_t>{0};
+        tdl::post_process_cwl = [&](YAML::Node & node) {
+            ++calls;
+            node["id"] = node["label"].Scalar();
+        };
+        auto results = tdl::convertAll(docs, tdl::Formats::CWL, {DESINIT(.threads =) 4});
+        assert(calls == docs.size());
+        for (size_t i{0}; i < docs.size(); ++i) {
+            assert(results[i].cwl == convertToCWL(docs[i]));
+            assert(results[i].cwl.find("id: tool" + std::to_string(i)) != std::string::npos);
+        }
+        tdl::post_process_cwl = nullptr;
+    }
+
+    { // options replace the global callback
+        tdl::post_process_cwl = [](YAML::Node & node) {
+            node["id"] = "global";
+        };
+        auto options = tdl::CWLOptions{};
+        options.hooks.push_back([](YAML::Node & node) {
+            node["id"] = "option";
+        });
+        auto results = tdl::convertAll(docs, tdl::Formats::CWL, options, {DESINIT(.threads =) 4});
+        for (size_t i{0}; i < docs.size(); ++i) {
+            assert(results[i].cwl == convertToCWL(docs[i], options));
+            assert(results[i].cwl.find("id: option") != std::string::npos);
+        }
+        tdl::post_process_cwl = nullptr;
+    }
+
+    { // the exception of the first failing document is rethrown
+        tdl::post_process_cwl = [&](YAML::Node & node) {
+            auto label = node["label"].Scalar();
+            if (label == "tool13" || label == "tool42") {
+                throw std::runtime_error{label};
+            }
+        };
+        try {
+            tdl::convertAll(docs, tdl::Formats::All, {DESINIT(.threads =) 4});
+            assert(false);
+        } catch (std::runtime_error const & e) {
+            assert(e.what() == std::string{"tool13"});
+        }
+        tdl::post_process_cwl = nullptr;
+    }
+}
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <tdl/convertToString.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+
+#include "utils.h"
+
+namespace {
+//!\brief formatting as it was done before switching to std::to_chars
+auto referenceString(double v) -> std::string {
+    auto ss = std::stringstream{};
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << v;
+    return ss.str();
+}
+
+auto bits(double v) -> uint64_t {
+    auto r = uint64_t{};
+    std::memcpy(&r, &v, sizeof(v));
+    return r;
+}
+
+//!\brief the new representation must parse to exactly the same double as the reference representation
+void checkRoundTrip(double v) {
+    auto str       = tdl::detail::convertToString(v);
+    auto reference = referenceString(v);
+    assert(str.size() <= reference.size());
+    assert(bits(std::strtod(str.c_str(), nullptr)) == bits(std::strtod(reference.c_str(), nullptr)));
+    assert(bits(std::strtod(str.c_str(), nullptr)) == bits(v));
+}
+} // namespace
+
+void testConvertToString() {
+    using tdl::detail::convertToString;
+
+    { // integers
+        assert(convertToString(0) == "0");
+        assert(convertToString(-42) == "-42");
+        assert(convertToString(std::numeric_limits<int>::max()) == "2147483647");
+        assert(convertToString(std::numeric_limits<int64_t>::min()) == "-9223372036854775808");
+    }
+
+    { // doubles use the shortest representation but keep the layout of %g
+        assert(convertToString(0.) == "0");
+        assert(convertToString(-0.) == "-0");
+        assert(convertToString(0.5) == "0.5");
+        assert(convertToString(0.1) == "0.1");
+        assert(convertToString(-1.25) == "-1.25");
+        assert(convertToString(100000.) == "100000");
+        assert(convertToString(123456.789) == "123456.789");
+        assert(convertToString(0.0001) == "0.0001");
+        assert(convertToString(0.00001) == "1e-05");
+        assert(convertToString(1.5e-7) == "1.5e-07");
+        assert(convertToString(1e16) == "10000000000000000");
+        assert(convertToString(1e17) == "1e+17");
+        assert(convertToString(-2.5e300) == "-2.5e+300");
+        assert(convertToString(std::numeric_limits<double>::infinity()) == "inf");
+        assert(convertToString(-std::numeric_limits<double>::infinity()) == "-inf");
+    }
+
+    { // round trip is bit exact against the previous stringstream based output
+        for (auto v : {0.,
+                       -0.,
+                       0.1,
+                       1. / 3.,
+                       2. / 3.,
+                       1e-4,
+                       9.999999999999999e-5,
+                       1e23,
+                       5e-324,
+                       std::numeric_limits<double>::min(),
+                       std::numeric_limits<double>::max(),
+                       std::numeric_limits<double>::lowest(),
+                       std::numeric_limits<double>::epsilon()}) {
+            checkRoundTrip(v);
+        }
+
+        auto rng = std::mt19937_64{42};
+        for (size_t i{0}; i < 100'000; ++i) {
+            auto raw = rng();
+            auto v   = double{};
+            std::memcpy(&v, &raw, sizeof(v));
+            if (std::isfinite(v)) {
+                checkRoundTrip(v);
+            }
+        }
+
+        // values with few digits, as typically found in parameter files
+        auto dist = std::uniform_int_distribution<int>{-100'000, 100'000};
+        for (size_t i{0}; i < 10'000; ++i) {
+            checkRoundTrip(dist(rng) / 1000.);
+            checkRoundTrip(dist(rng) * 1e-9);
+        }
+    }
+}
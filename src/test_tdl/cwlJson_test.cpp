@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <any>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+#include <tdl/cwl_v1_2.h>
+#include <tdl/cwl_v1_2_json.h>
+#include <tdl/jsonWriter.h>
+#include <yaml-cpp/yaml.h>
+
+#include "utils.h"
+#include "yamlUtils.h"
+
+void testCWLJson() {
+    namespace cwl = w3id_org::cwl::cwl;
+
+    { // the writer escapes strings, text that is no JSON number is written as string
+        auto out    = std::string{};
+        auto writer = tdl::detail::JSONWriter{out};
+        writer.beginMap();
+        writer.key("text");
+        writer.string("a \"quoted\"\n\\ \x01");
+        writer.key("numbers");
+        writer.beginSeq();
+        writer.scalar("1");
+        writer.scalar("-2.5e3");
+        writer.scalar("01");
+        writer.scalar(".nan");
+        writer.null();
+        writer.endSeq();
+        writer.key("empty");
+        writer.beginMap();
+        writer.endMap();
+        writer.endMap();
+        assert(out == R"({"text":"a \"quoted\"\n\\ \u0001","numbers":[1,-2.5e3,"01",".nan",null],"empty":{}})");
+    }
+
+    { // quoted and plain scalars differ, even with the same text
+        assert(equalNodes(YAML::Load("[.inf, a, 1]"), YAML::Load("[.inf, \"a\", 1]")));
+        assert(!equalNodes(YAML::Load("[.inf]"), YAML::Load("[\".inf\"]")));
+        assert(!equalNodes(YAML::Load("[1]"), YAML::Load("[\"1\"]")));
+    }
+
+    { // convertToCWLJson writes the same document as convertToCWL
+        auto doc                    = tdl::ToolInfo{};
+        doc.metaInfo.name           = "tool";
+        doc.metaInfo.description    = "a \"tool\"\nwith two lines";
+        doc.metaInfo.executableName = "/usr/bin/tool";
+        doc.params                  = {{"input", "an input file", {"file", "required"}, tdl::StringValue{}},
+                                       {"output", "an output file", {"output", "file"}, tdl::StringValue{}},
+                                       {"threads", "threads", {}, tdl::IntValue{4}},
+                                       {"ratio", "a ratio", {}, tdl::DoubleValue{0.25}},
+                                       {"flag", "a flag", {}, tdl::BoolValue{true}},
+                                       {"names", "some names", {}, tdl::StringValueList{{"a", "b"}}},
+                                       {"sub", "a group", {}, tdl::Node::Children{
+                                           {"mode", "the mode", {}, tdl::StringValue{"fast"}},
+                                       }}};
+        doc.cliMapping = {{"--input", "input"}, {"--output", "output"}, {"--threads", "threads"},
+                          {"--ratio", "ratio"}, {"--flag", "flag"},     {"--names", "names"},
+                          {"--sub-mode", "sub.mode"}};
+
+        auto json = tdl::convertToCWLJson(doc);
+        assert(equalNodes(YAML::Load(json), YAML::Load(tdl::convertToCWL(doc, {}))));
+        assert(tdl::convertToCWLJson(doc) == json);
+
+        // JSON has no infinity, the default is omitted instead of written as string, strings stay strings
+        doc.params.push_back({"limit", "a limit", {}, tdl::DoubleValue{-INFINITY}});
+        doc.params.push_back({"scale", "a scale", {}, tdl::DoubleValue{NAN}});
+        doc.params.push_back({"mode", "a mode", {}, tdl::StringValue{"1.5"}});
+        doc.cliMapping.push_back({"--limit", "limit"});
+        doc.cliMapping.push_back({"--scale", "scale"});
+        doc.cliMapping.push_back({"--mode", "mode"});
+        auto yaml = YAML::Load(tdl::convertToCWL(doc, {}));
+        assert(scalarKind(yaml["inputs"]["limit"]["default"]) == 'n');
+        auto withLimit = YAML::Load(tdl::convertToCWLJson(doc));
+        assert(withLimit["inputs"]["limit"]["type"].Scalar() == "double?");
+        assert(!withLimit["inputs"]["limit"]["default"].IsDefined());
+        assert(!withLimit["inputs"]["scale"]["default"].IsDefined());
+        assert(withLimit["inputs"]["ratio"]["default"].Scalar() == "0.25");
+        assert(scalarKind(withLimit["inputs"]["mode"]["default"]) == 's');
+    }
+
+    { // doubles are written as numbers, formatDouble only changes the text of finite values
+        auto input      = cwl::CommandInputParameter{};
+        *input.id       = "ratio";
+        *input.type     = cwl::CWLType::double_;
+        *input.default_ = std::any{0.1};
+        auto tool       = cwl::CommandLineTool{};
+        tool.inputs->push_back(input);
+        assert(w3id_org::cwl::store_document_as_json(tool).find("\"default\":0.1") != std::string::npos);
+
+        auto config         = w3id_org::cwl::store_config{};
+        config.formatDouble = [](double) {
+            return std::string{"1e-1"};
+        };
+        assert(w3id_org::cwl::toYaml(std::any{0.1}, config).Scalar() == "1e-1");
+        assert(w3id_org::cwl::toYaml(std::any{INFINITY}, config).Scalar() != "1e-1");
+        assert(w3id_org::cwl::toYaml(std::any{0.1}, {}).Scalar() != "1e-1");
+
+        auto doc   = tdl::ToolInfo{};
+        doc.params = {{"ratio", "a ratio", {}, tdl::DoubleValue{0.1}}};
+        assert(YAML::Load(tdl::convertToCWL(doc, {}))["inputs"]["ratio"]["default"].Scalar() == "0.1");
+        auto reference = YAML::Load(tdl::detail::convertToCWLReference(doc, {}));
+        assert(reference["inputs"]["ratio"]["default"].Scalar() == "0.1");
+        assert(scalarKind(reference["inputs"]["ratio"]["default"]) == 'n');
+    }
+
+    auto const tool = std::string{"cwlVersion: v1.2\n"
+                                  "class: CommandLineTool\n"
+                                  "id: tool\n"
+                                  "doc: \"a \\\"tool\\\"\\n\\u00e9\"\n"
+                                  "baseCommand: [tool, run]\n"
+                                  "inputs:\n"
+                                  "  reads: File[]?\n"
+                                  "  mode: string\n"
+                                  "  threads:\n"
+                                  "    type: int?\n"
+                                  "    inputBinding: {prefix: --threads, position: 2}\n"
+                                  "outputs:\n"
+                                  "  out: {type: File, outputBinding: {glob: '*.txt'}}\n"
+                                  "requirements:\n"
+                                  "  ResourceRequirement: {coresMin: 2, ramMax: 2.5}\n"
+                                  "  InlineJavascriptRequirement: {}\n"};
+    auto const workflow = std::string{"cwlVersion: v1.2\n"
+                                      "class: Workflow\n"
+                                      "id: main\n"
+                                      "inputs: {reads: 'File[]'}\n"
+                                      "outputs:\n"
+                                      "  out: {type: File, outputSource: step/out}\n"
+                                      "steps:\n"
+                                      "  step:\n"
+                                      "    run: '#tool'\n"
+                                      "    in: {reads: reads}\n"
+                                      "    out: [out]\n"
+                                      "    scatter: reads\n"
+                                      "requirements:\n"
+                                      "  - class: ScatterFeatureRequirement\n"};
+
+    { // documents stored as JSON load as the same structs, with the JSON reader and with yaml-cpp
+        for (auto const & text : {tool, workflow}) {
+            auto root     = w3id_org::cwl::load_document_from_string(text);
+            auto expected = w3id_org::cwl::store_document_as_string(root);
+            auto json     = w3id_org::cwl::store_document_as_json(root);
+            assert(w3id_org::cwl::store_document_as_string(w3id_org::cwl::load_document_from_json(json)) == expected);
+            assert(w3id_org::cwl::store_document_as_string(w3id_org::cwl::load_document_from_string(json)) == expected);
+            assert(w3id_org::cwl::store_document_as_json(w3id_org::cwl::load_document_from_json(json)) == json);
+        }
+
+        auto root = w3id_org::cwl::load_document_from_json(
+            w3id_org::cwl::store_document_as_json(w3id_org::cwl::load_document_from_string(tool)));
+        auto & loaded = std::get<cwl::CommandLineTool>(root);
+        assert(std::get<std::string>(*loaded.doc) == "a \"tool\"\n\xc3\xa9");
+        assert(loaded.inputs->size() == 3);
+    }
+
+    { // whitespace, escape sequences and surrogate pairs
+        auto root = w3id_org::cwl::load_document_from_json(" {\n\t\"class\" : \"CommandLineTool\",\r\n"
+                                                           "  \"label\": \"\\u0041\\/\\ud83d\\ude00\",\n"
+                                                           "  \"inputs\": [ ], \"outputs\": [] } ");
+        auto & loaded = std::get<cwl::CommandLineTool>(root);
+        assert(std::get<std::string>(*loaded.label) == "A/\xf0\x9f\x98\x80");
+    }
+
+    { // invalid JSON is reported
+        for (auto text : {"", "{", "{\"class\": }", "{\"class\" \"Workflow\"}", "[1,]", "{} {}", "[01]",
+                          "[\"\\x\"]", "[\"\\ud83d\"]", "[tru]", "{\"a\": 1,}"}) {
+            auto failed = false;
+            try {
+                w3id_org::cwl::load_document_from_json(text);
+            } catch (std::runtime_error const &) {
+                failed = true;
+            }
+            assert(failed);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <tdl/escapeXML.h>
+
+#include "utils.h"
+
+void testEscapeXML() {
+    using tdl::detail::escapeXML;
+
+    { // strings without special characters are returned unchanged
+        assert(escapeXML("") == "");
+        assert(escapeXML("plain text without special characters") == "plain text without special characters");
+    }
+
+    { // all special characters
+        assert(escapeXML("&<>\"'\t\n") == "&amp;&lt;&gt;&quot;&apos;&#x9;#br#");
+        assert(escapeXML("a & b") == "a &amp; b");
+    }
+
+    { // special characters at every position, covering the SIMD and the scalar part of the search
+        for (size_t len{1}; len < 80; ++len) {
+            for (size_t pos{0}; pos < len; ++pos) {
+                auto input = std::string(len, 'x');
+                input[pos] = '<';
+
+                auto expected = std::string(pos, 'x') + "&lt;" + std::string(len - pos - 1, 'x');
+                assert(tdl::detail::findXMLEscape(input) == pos);
+                assert(escapeXML(input) == expected);
+            }
+            assert(tdl::detail::findXMLEscape(std::string(len, 'x')) == std::string_view::npos);
+        }
+    }
+
+    { // non ascii characters are not touched
+        assert(escapeXML("Größe < 5µm") == "Größe &lt; 5µm");
+    }
+
+    { // unescaping is the inverse of escaping
+        auto unescape = [](std::string_view str) {
+            auto out = std::string{};
+            tdl::detail::appendUnescapedXML(out, str);
+            return out;
+        };
+        for (auto str : {"", "plain", "&<>\"'\t\n", "a & b", "Größe < 5µm", "#br", "# br #"}) {
+            assert(unescape(escapeXML(str)) == str);
+        }
+        assert(tdl::detail::findXMLUnescape("plain # text") == std::string_view::npos);
+        assert(tdl::detail::findXMLUnescape("line#br#") == 4);
+
+        // numeric character references and unknown entities
+        assert(unescape("&#x41;&#66;&#xB5;") == "AB\xc2\xb5");
+        assert(unescape("&unknown; & &#xZZ; &amp") == "&unknown; & &#xZZ; &amp");
+    }
+}
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+void testFingerprint() {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.version        = "1.0.0";
+    doc.metaInfo.name           = "tool";
+    doc.metaInfo.executableName = "tool";
+    doc.metaInfo.citations      = {{"doi", "url"}};
+    doc.params                  = {
+        {"threads", "number of threads", {"advanced"}, tdl::IntValue{4, 1, 64}},
+        {"input", "an input file", {"file", "required"}, tdl::StringValue{"in.fa"}},
+        {"section",
+         "a section",
+         {},
+         tdl::Node::Children{
+             {"ratio", "a ratio", {}, tdl::DoubleValueList{{0.5, 0.25}, 0.0, 1.0}},
+             {"mode", "a mode", {"custom tag"}, tdl::StringValue{"fast", {{"fast", "slow"}}}},
+         }},
+    };
+    doc.cliMapping = {{"--threads", "threads"}};
+    auto const base = tdl::fingerprint(doc);
+
+    { // equal documents have equal fingerprints, the hash does not change between versions or platforms
+        assert(tdl::fingerprint(doc) == base);
+        assert(tdl::fingerprint(tdl::ToolInfo{doc}) == base);
+        assert(tdl::fingerprint(tdl::ToolInfo{}).toString() == "d79151bed8b91f1c7492e60829b406e2");
+        assert(base.toString() == "170432a1ecaa72291f83d2464f0ec4b0");
+        assert((tdl::Fingerprint{0x0123456789abcdef, 0xfedcba9876543210}.toString()
+                == "fedcba98765432100123456789abcdef"));
+    }
+
+    { // every part of the document changes the fingerprint
+        auto changes = std::vector<tdl::ToolInfo>(9, doc);
+        changes[0].metaInfo.version = "1.0.1";
+        changes[1].metaInfo.citations.clear();
+        changes[2].params[0].description = "threads";
+        changes[3].params[0].tags.insert("required");
+        std::get<tdl::IntValue>(changes[4].params[0].value).maxLimit = 32;
+        std::get<tdl::IntValue>(changes[5].params[0].value).value    = 5;
+        std::get<tdl::Node::Children>(changes[6].params[2].value).pop_back();
+        changes[7].cliMapping[0].optionIdentifier = "-t";
+        changes[8].params[1].value                = tdl::StringValueList{{"in.fa"}};
+
+        auto fingerprints = std::vector<tdl::Fingerprint>{base};
+        for (auto const & change : changes) {
+            auto fingerprint = tdl::fingerprint(change);
+            for (auto const & other : fingerprints) {
+                assert(fingerprint != other);
+            }
+            fingerprints.push_back(fingerprint);
+        }
+
+        // strings are hashed with their length, moving characters between fields is a change
+        auto a = doc;
+        auto b = doc;
+        a.metaInfo.name   = "ab";
+        a.metaInfo.docurl = "c";
+        b.metaInfo.name   = "a";
+        b.metaInfo.docurl = "bc";
+        assert(tdl::fingerprint(a) != tdl::fingerprint(b));
+    }
+
+    { // all NaNs are alike
+        auto a = doc;
+        auto b = doc;
+        a.params[0].value = tdl::DoubleValue{std::numeric_limits<double>::quiet_NaN()};
+        b.params[0].value = tdl::DoubleValue{-std::numeric_limits<double>::quiet_NaN()};
+        assert(tdl::fingerprint(a) == tdl::fingerprint(b));
+    }
+
+#if TDL_HAS_PMR
+    { // independent of the allocator
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        assert(tdl::fingerprint(tdl::pmr::ToolInfo{doc, &arena}) == base);
+    }
+#endif
+}
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+void testFlatTree() {
+    auto params = tdl::Node::Children{
+        {"input", "an input file", {"file", "required"}, tdl::StringValue{"in.fa"}},
+        {"options",
+         "nested options",
+         {},
+         tdl::Node::Children{
+             {"threads", "number of threads", {"advanced"}, tdl::IntValue{4}},
+             {"output", "an output file", {"file", "output", "required"}, tdl::StringValue{"out.fa"}},
+             {"more",
+              "more options",
+              {},
+              tdl::Node::Children{{"input", "a second input", {"file"}, tdl::StringValue{}}}},
+         }},
+        {"flag", "a flag", {"advanced", "custom tag"}, tdl::BoolValue{false}},
+    };
+
+    { // pre-order arrays
+        auto tree = tdl::FlatTree{params};
+        assert(tree.size() == 7);
+        assert(!tree.empty());
+
+        auto names = std::vector<std::string_view>{};
+        for (size_t i{0}; i < tree.size(); ++i) {
+            names.push_back(tree.name(i));
+        }
+        assert((names
+                == std::vector<std::string_view>{"input", "options", "threads", "output", "more", "input", "flag"}));
+
+        assert(tree.parent(0) == tdl::FlatTree::noParent);
+        assert(tree.parent(2) == 1);
+        assert(tree.parent(5) == 4);
+        assert(tree.parent(6) == tdl::FlatTree::noParent);
+        assert(tree.depth(0) == 0 && tree.depth(3) == 1 && tree.depth(5) == 2);
+        assert(tree.subtreeEnd(0) == 1);
+        assert(tree.subtreeEnd(1) == 6);
+        assert(tree.subtreeEnd(4) == 6);
+
+        assert(tree.kind(0) == tdl::ValueKind::String);
+        assert(tree.kind(1) == tdl::ValueKind::Children);
+        assert(tree.kind(2) == tdl::ValueKind::Int);
+        assert(tree.kind(6) == tdl::ValueKind::Bool);
+
+        // only the known tags are part of the view
+        assert(tree.hasTag(6, tdl::Tag::advanced));
+        assert(tree.tags(6) == params[2].tags.knownTags());
+        assert(!tree.hasTag(6, tdl::Tag::required));
+    }
+
+    { // interned names
+        auto tree = tdl::FlatTree{params};
+        assert(tree.nameCount() == 6);
+        assert(tree.nameId(0) == tree.nameId(5));
+        assert(tree.findName("threads") == tree.nameId(2));
+        assert(!tree.findName("unknown"));
+        assert(tree.internedName(*tree.findName("more")) == "more");
+    }
+
+    { // queries
+        auto tree = tdl::FlatTree{params};
+        assert((tree.find("input") == std::vector<uint32_t>{0, 5}));
+        assert(tree.find("unknown").empty());
+        assert((tree.withTags({tdl::Tag::file, tdl::Tag::required}) == std::vector<uint32_t>{0, 3}));
+        assert((tree.withTags({tdl::Tag::advanced}) == std::vector<uint32_t>{2, 6}));
+        assert(tree.withTags({}).size() == tree.size());
+        assert((tree.withTags(tdl::ValueKind::String, {tdl::Tag::file}) == std::vector<uint32_t>{0, 3, 5}));
+        assert((tree.withTags(tdl::ValueKind::Children, {}) == std::vector<uint32_t>{1, 4}));
+
+        assert(tree.path(5) == "options:more:input");
+        assert(tree.path(5, '.') == "options.more.input");
+        assert(tree.path(0) == "input");
+    }
+
+    { // the view is independent of the tree and copyable
+        auto tree = tdl::FlatTree{};
+        {
+            auto copy = params;
+            tree      = tdl::FlatTree{copy};
+        }
+        auto other = tree;
+        assert(other.path(3) == "options:output");
+        assert(tdl::FlatTree{}.empty());
+        assert(tdl::FlatTree{}.nameCount() == 0);
+    }
+
+#if TDL_HAS_PMR
+    { // a pmr tree yields the same view
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        auto doc   = tdl::ToolInfo{};
+        doc.params = params;
+        auto tree  = tdl::FlatTree{tdl::pmr::ToolInfo{doc, &arena}.params};
+        assert(tree.size() == 7);
+        assert(tree.path(5) == "options:more:input");
+        assert((tree.withTags({tdl::Tag::file, tdl::Tag::required}) == std::vector<uint32_t>{0, 3}));
+    }
+#endif
+}
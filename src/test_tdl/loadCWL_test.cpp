@@ -0,0 +1,448 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <tdl/cwl_v1_2.h>
+#include <tdl/cwl_v1_2_json.h>
+#include <tdl/cwl_v1_2_stream.h>
+
+#include "utils.h"
+
+void testLoadCWL() {
+    namespace cwl = w3id_org::cwl::cwl;
+
+    { // the alternatives of requirements are selected by their class, numbers by their kind
+        auto root = w3id_org::cwl::load_document_from_string("cwlVersion: v1.2\n"
+                                                             "class: Workflow\n"
+                                                             "inputs: {}\n"
+                                                             "outputs: {}\n"
+                                                             "steps: []\n"
+                                                             "requirements:\n"
+                                                             "  - class: ScatterFeatureRequirement\n"
+                                                             "  - class: DockerRequirement\n"
+                                                             "    dockerPull: example/tool:1.0\n"
+                                                             "  - class: ResourceRequirement\n"
+                                                             "    coresMin: 2\n"
+                                                             "    coresMax: 2.5\n"
+                                                             "    ramMin: 5000000000\n");
+        assert(std::holds_alternative<cwl::Workflow>(root));
+        auto & requirements = std::get<1>(*std::get<cwl::Workflow>(root).requirements);
+        assert(requirements.size() == 3);
+        assert(std::holds_alternative<cwl::ScatterFeatureRequirement>(requirements[0]));
+        assert(std::holds_alternative<cwl::DockerRequirement>(requirements[1]));
+        assert(std::get<std::string>(*std::get<cwl::DockerRequirement>(requirements[1]).dockerPull)
+               == "example/tool:1.0");
+
+        auto & resources = std::get<cwl::ResourceRequirement>(requirements[2]);
+        assert(std::get<int32_t>(*resources.coresMin) == 2);
+        assert(std::get<float>(*resources.coresMax) == 2.5f);
+        assert(std::get<int64_t>(*resources.ramMin) == 5'000'000'000);
+        assert(std::holds_alternative<std::monostate>(*resources.ramMax));
+    }
+
+    { // documents written by convertToCWL are read back
+        auto doc                    = tdl::ToolInfo{};
+        doc.metaInfo.name           = "tool";
+        doc.metaInfo.executableName = "tool";
+        doc.params                  = {{"input", "an input file", {"file", "required"}, tdl::StringValue{}},
+                                       {"output", "an output file", {"output", "file"}, tdl::StringValue{}},
+                                       {"names", "some names", {}, tdl::StringValueList{{"a", "b"}}}};
+        doc.cliMapping              = {{"--input", "input"}, {"--output", "output"}, {"--names", "names"}};
+
+        auto root = w3id_org::cwl::load_document_from_string(tdl::convertToCWL(doc, {}));
+        assert(std::holds_alternative<cwl::CommandLineTool>(root));
+        auto & tool = std::get<cwl::CommandLineTool>(root);
+        assert(tool.inputs->size() == 3 && tool.outputs->size() == 1);
+        assert(std::get<std::string>(*(*tool.inputs)[0].id) == "input");
+
+        // storing and loading again yields the same document
+        auto text = w3id_org::cwl::store_document_as_string(root);
+        assert(w3id_org::cwl::store_document_as_string(w3id_org::cwl::load_document_from_string(text)) == text);
+    }
+
+    { // copies do not share fields, whether they are stored inline or on the heap
+        auto input          = cwl::CommandInputParameter{};
+        *input.id           = "input";
+        *input.inputBinding = cwl::CommandLineBinding{};
+        auto copy           = input;
+        *copy.id            = "copy";
+        *std::get<cwl::CommandLineBinding>(*copy.inputBinding).prefix = "--copy";
+        assert(std::get<std::string>(*input.id) == "input");
+        assert(std::holds_alternative<std::monostate>(*std::get<cwl::CommandLineBinding>(*input.inputBinding).prefix));
+    }
+
+    { // no alternative matches an unknown class
+        auto failed = false;
+        try {
+            w3id_org::cwl::load_document_from_string("class: UnknownTool\ninputs: {}\noutputs: {}\n");
+        } catch (std::runtime_error const &) {
+            failed = true;
+        }
+        assert(failed);
+
+        failed = false;
+        try {
+            w3id_org::cwl::load_documents_from_string("class: UnknownTool\ninputs: {}\noutputs: {}\n");
+        } catch (std::runtime_error const &) {
+            failed = true;
+        }
+        assert(failed);
+    }
+
+    // the event based loader reads the same structs as load_document
+    auto const tool = std::string{"cwlVersion: v1.2\n"
+                                  "class: CommandLineTool\n"
+                                  "id: tool\n"
+                                  "doc: &doc a tool\n"
+                                  "label: *doc\n"
+                                  "baseCommand: [tool, run]\n"
+                                  "arguments: [--verbose]\n"
+                                  "inputs:\n"
+                                  "  reads: File[]?\n"
+                                  "  mode: string\n"
+                                  "  threads:\n"
+                                  "    type: int?\n"
+                                  "    inputBinding: {prefix: --threads, position: 2}\n"
+                                  "  names:\n"
+                                  "    type: {type: array, items: string}\n"
+                                  "outputs:\n"
+                                  "  out:\n"
+                                  "    type: File\n"
+                                  "    outputBinding: &glob {glob: '*.txt'}\n"
+                                  "  log: {type: File, outputBinding: *glob}\n"
+                                  "requirements:\n"
+                                  "  ResourceRequirement: {coresMin: 2, ramMax: 2.5}\n"
+                                  "  InlineJavascriptRequirement: {}\n"
+                                  "hints:\n"
+                                  "  - class: DockerRequirement\n"
+                                  "    dockerPull: example/tool:1.0\n"};
+    auto const workflow = std::string{"cwlVersion: v1.2\n"
+                                      "class: Workflow\n"
+                                      "id: main\n"
+                                      "inputs: {reads: 'File[]'}\n"
+                                      "outputs:\n"
+                                      "  out: {type: File, outputSource: step/out}\n"
+                                      "steps:\n"
+                                      "  step:\n"
+                                      "    run: '#tool'\n"
+                                      "    in: {reads: reads}\n"
+                                      "    out: [out]\n"
+                                      "    scatter: reads\n"
+                                      "requirements:\n"
+                                      "  - class: ScatterFeatureRequirement\n"};
+    auto const expected = [](std::string const & text) {
+        return w3id_org::cwl::store_document_as_string(w3id_org::cwl::load_document_from_string(text));
+    };
+
+    { // single documents
+        auto converted = tdl::ToolInfo{};
+        converted.metaInfo.name           = "converted";
+        converted.metaInfo.executableName = "converted";
+        converted.params                  = {{"input", "an input file", {"file", "required"}, tdl::StringValue{}},
+                                             {"names", "some names", {}, tdl::StringValueList{{"a", "b"}}}};
+        converted.cliMapping              = {{"--input", "input"}, {"--names", "names"}};
+
+        for (auto const & text : {tool, workflow, tdl::convertToCWL(converted, {})}) {
+            auto documents = w3id_org::cwl::load_documents_from_string(text);
+            assert(documents.size() == 1);
+            assert(w3id_org::cwl::store_document_as_string(documents[0]) == expected(text));
+        }
+
+        auto documents = w3id_org::cwl::load_documents_from_string(tool);
+        auto & loaded  = std::get<cwl::CommandLineTool>(documents[0]);
+        assert(loaded.inputs->size() == 4 && std::get<std::string>(*(*loaded.inputs)[2].id) == "threads");
+        assert(std::get<std::string>(*loaded.label) == "a tool");
+    }
+
+    { // several documents in one stream, the processes of a `$graph` one by one
+        auto indented = [](std::string text) {
+            for (auto pos = text.find('\n'); pos + 1 < text.size(); pos = text.find('\n', pos + 1)) {
+                text.insert(pos + 1, "    ");
+            }
+            return "  - " + text;
+        };
+        auto packed    = "cwlVersion: v1.2\n$graph:\n" + indented(tool) + indented(workflow);
+        auto documents = w3id_org::cwl::load_documents_from_string(packed + "---\n" + workflow);
+        assert(documents.size() == 3);
+        assert(w3id_org::cwl::store_document_as_string(documents[0]) == expected(tool));
+        assert(w3id_org::cwl::store_document_as_string(documents[1]) == expected(workflow));
+        assert(w3id_org::cwl::store_document_as_string(documents[2]) == expected(workflow));
+    }
+
+    /* every record type, read by load_document, by the generated record readers of load_documents and by the
+     * JSON reader from the output of the generated record writers. The stored documents are compared without
+     * simplification, so a field dropped by one of them shows up.
+     * Left out are forms load_document rejects: Dirent and CommandLineBinding as variant alternatives (they have
+     * no constant field to detect them by), WorkflowStepOutput as map, Input/OutputEnumSchema, secondaryFiles as
+     * strings and expressions in ResourceRequirement.
+     */
+    auto const allTool       = std::string{R"cwl(cwlVersion: v1.2
+class: CommandLineTool
+id: all_tool
+label: all tool
+doc: [a tool, with two lines]
+intent: [http://edamontology.org/operation_0004]
+baseCommand: [tool, run]
+arguments:
+  - --verbose
+  - $(runtime.cores)
+stdin: $(inputs.reads.path)
+stdout: out.txt
+stderr: err.txt
+successCodes: [0, 1]
+temporaryFailCodes: [2]
+permanentFailCodes: [3]
+inputs:
+  reads:
+    type: File
+    format: http://edamontology.org/format_1930
+    loadContents: true
+    loadListing: shallow_listing
+    streamable: true
+    secondaryFiles:
+      - {pattern: .bai, required: false}
+      - {pattern: .fai}
+    inputBinding: {prefix: --reads, position: 3, loadContents: false}
+  directory: {type: "Directory?", loadListing: deep_listing}
+  options:
+    type:
+      type: record
+      name: options_record
+      doc: the options
+      fields:
+        - name: level
+          type: int
+          doc: the level
+          inputBinding: {prefix: --level}
+        - name: extra
+          type: File?
+          secondaryFiles: [{pattern: .idx}]
+          format: http://edamontology.org/format_2572
+          loadContents: true
+          loadListing: no_listing
+          streamable: false
+  mode:
+    type:
+      type: enum
+      name: mode_enum
+      symbols: [fast, slow]
+      inputBinding: {prefix: --mode}
+  names:
+    type:
+      type: array
+      items: string
+      inputBinding: {prefix: --name, separate: true}
+    inputBinding: {itemSeparator: ",", prefix: --names}
+  ratio: {type: "double?", id: ratio, label: the ratio}
+  count: long?
+outputs:
+  result:
+    type: File
+    format: http://edamontology.org/format_1930
+    streamable: true
+    secondaryFiles: [{pattern: .bai, required: true}]
+    outputBinding:
+      glob: [$(inputs.reads.nameroot).out]
+      loadContents: true
+      loadListing: shallow_listing
+      outputEval: $(self[0])
+  summary:
+    type:
+      type: record
+      name: summary_record
+      fields:
+        - name: lines
+          type: int
+          outputBinding: {glob: lines.txt, loadContents: true, outputEval: "$(parseInt(self[0].contents))"}
+          secondaryFiles: [{pattern: .md5, required: true}]
+          format: http://edamontology.org/format_3475
+  state:
+    type: {type: enum, name: state_enum, symbols: [ok, failed]}
+    outputBinding: {glob: state.txt}
+  logs:
+    type: {type: array, items: File}
+    outputBinding: {glob: "*.log"}
+  captured: stdout
+  errors: stderr
+requirements:
+  InlineJavascriptRequirement: {expressionLib: ["function f() { return 1; }"]}
+  SchemaDefRequirement:
+    types:
+      - {type: record, name: def_record, fields: [{name: value, type: string, inputBinding: {position: 4}}]}
+      - {type: enum, name: def_enum, symbols: [a, b]}
+      - {type: array, name: def_array, items: int}
+  LoadListingRequirement: {loadListing: deep_listing}
+  DockerRequirement:
+    dockerPull: example/tool:1.0
+    dockerImageId: tool
+    dockerOutputDirectory: /out
+  SoftwareRequirement:
+    packages:
+      - {package: tool, version: ["1.0", "1.1"], specs: [https://identifiers.org/biotools/tool]}
+      - package: other
+  InitialWorkDirRequirement:
+    listing:
+      - {class: File, location: config.txt, basename: config.txt, contents: "threads=4"}
+      - {class: Directory, location: data, listing: [{class: File, location: data/a.txt, checksum: sha1$abc}]}
+  EnvVarRequirement:
+    envDef:
+      - {envName: TOOL_HOME, envValue: /opt/tool}
+      - {envName: TOOL_MODE, envValue: $(inputs.mode)}
+  ShellCommandRequirement: {}
+  ResourceRequirement: {coresMin: 1, coresMax: 4, ramMin: 1024, ramMax: 2048.5, tmpdirMin: 10, outdirMax: 20}
+  WorkReuse: {enableReuse: false}
+  NetworkAccess: {networkAccess: true}
+  InplaceUpdateRequirement: {inplaceUpdate: false}
+  ToolTimeLimit: {timelimit: 600}
+hints:
+  - {class: DockerRequirement, dockerFile: "FROM debian", dockerLoad: image.tar, dockerImport: image.tgz}
+  - {class: ResourceRequirement, coresMin: 2, ramMin: 512}
+)cwl"};
+    auto const allWorkflow   = std::string{R"cwl(cwlVersion: v1.2
+class: Workflow
+id: all_workflow
+label: all workflow
+doc: a workflow
+inputs:
+  reads:
+    type: "File[]"
+    secondaryFiles: [{pattern: .bai}]
+    format: http://edamontology.org/format_2572
+    loadContents: false
+  options:
+    type:
+      type: record
+      name: wf_options
+      fields:
+        - {name: level, type: int, doc: the level, secondaryFiles: [{pattern: .x}], loadListing: no_listing}
+  mode: string
+  thresholds:
+    type: {type: array, items: float}
+  skip: boolean?
+outputs:
+  merged:
+    type: File
+    outputSource: merge/out
+    linkMerge: merge_flattened
+    pickValue: first_non_null
+    secondaryFiles: [{pattern: .bai}]
+    streamable: false
+  table:
+    type: {type: record, name: wf_table, fields: [{name: rows, type: int}]}
+    outputSource: [count/table]
+  states:
+    type: {type: array, items: string}
+    outputSource: count/states
+steps:
+  count:
+    in:
+      reads: reads
+      level: {source: options, valueFrom: $(self.level)}
+      mode: {source: [mode], linkMerge: merge_nested, pickValue: the_only_non_null, loadContents: true}
+      constant: {valueFrom: "1"}
+    out: [table, states]
+    scatter: [reads]
+    scatterMethod: dotproduct
+    when: $(!inputs.skip)
+    run:
+      class: ExpressionTool
+      inputs:
+        reads: File[]
+        level: int
+        mode: string
+        constant: string
+      outputs:
+        table:
+          type: Any
+          secondaryFiles: [{pattern: .x}]
+          format: http://edamontology.org/format_3475
+          streamable: true
+        states: {type: "string[]"}
+      expression: "${ return {table: null, states: []}; }"
+      requirements: [{class: InlineJavascriptRequirement}]
+  merge:
+    in: {reads: {source: reads}}
+    out: [out]
+    run:
+      class: Workflow
+      inputs: {reads: "File[]"}
+      outputs: {out: {type: File, outputSource: cat/out}}
+      steps:
+        cat:
+          in: {reads: reads}
+          out: [out]
+          run: cat.cwl
+          requirements: {ResourceRequirement: {coresMin: 1}}
+          hints: [{class: ToolTimeLimit, timelimit: 10}]
+  plan:
+    in: {reads: reads}
+    out: [out]
+    run:
+      class: Operation
+      inputs:
+        reads: {type: "File[]", secondaryFiles: [{pattern: .bai}], format: http://edamontology.org/format_2572}
+      outputs:
+        out: {type: File, format: http://edamontology.org/format_1930, secondaryFiles: [{pattern: .bai}]}
+requirements:
+  SubworkflowFeatureRequirement: {}
+  ScatterFeatureRequirement: {}
+  MultipleInputFeatureRequirement: {}
+  StepInputExpressionRequirement: {}
+  InlineJavascriptRequirement: {}
+)cwl"};
+    auto const allExpression = std::string{R"cwl(cwlVersion: v1.2
+class: ExpressionTool
+id: expression
+inputs:
+  values: "int[]"
+  settings: {type: {type: record, fields: [{name: scale, type: float}]}}
+outputs:
+  sum: {type: int, doc: the sum}
+expression: "${ return {sum: 3}; }"
+requirements: {InlineJavascriptRequirement: {}}
+)cwl"};
+    auto const allOperation  = std::string{R"cwl(cwlVersion: v1.2
+class: Operation
+id: operation
+doc: an abstract step
+inputs:
+  reads: {type: {type: array, items: File}, loadContents: true, loadListing: no_listing}
+outputs:
+  report: {type: File, streamable: true, label: the report}
+hints: [{class: DockerRequirement, dockerPull: example/op}]
+)cwl"};
+    { // the same structs through all loaders
+        auto const config    = w3id_org::cwl::store_config{false, false, false};
+        auto const documents = {allTool, allWorkflow, allExpression, allOperation};
+        auto expected        = std::vector<std::string>{};
+        for (auto const & text : documents) {
+            auto root = w3id_org::cwl::load_document_from_string(text);
+            expected.push_back(w3id_org::cwl::store_document_as_string(root, config));
+
+            auto streamed = w3id_org::cwl::load_documents_from_string(text);
+            assert(streamed.size() == 1);
+            assert(w3id_org::cwl::store_document_as_string(streamed[0], config) == expected.back());
+
+            auto json = w3id_org::cwl::load_document_from_json(w3id_org::cwl::store_document_as_json(root));
+            assert(w3id_org::cwl::store_document_as_string(json, config) == expected.back());
+        }
+        auto root                 = w3id_org::cwl::load_document_from_string(allTool);
+        auto const & requirements = std::get<1>(*std::get<cwl::CommandLineTool>(root).requirements);
+        assert(requirements.size() == 13);
+
+        auto stream = std::string{};
+        for (auto const & text : documents) {
+            stream += "---\n" + text;
+        }
+        auto streamed = w3id_org::cwl::load_documents_from_string(stream);
+        assert(streamed.size() == expected.size());
+        for (size_t i{0}; i < streamed.size(); ++i) {
+            assert(w3id_org::cwl::store_document_as_string(streamed[i], config) == expected[i]);
+        }
+    }
+}
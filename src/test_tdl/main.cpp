@@ -6,10 +6,36 @@
 
 void testCTD();
 void testCWL();
+void testEscapeXML();
+void testConvertToString();
+void testParseCTD();
+void testConvertAll();
+void testTags();
+void testPmr();
+void testFlatTree();
+void testPathIndex();
+void testValidate();
+void testFingerprint();
+void testConversionCache();
+void testLoadCWL();
+void testCWLJson();
 
 int main() {
     testCTD();
     testCWL();
+    testEscapeXML();
+    testConvertToString();
+    testParseCTD();
+    testConvertAll();
+    testTags();
+    testPmr();
+    testFlatTree();
+    testPathIndex();
+    testValidate();
+    testFingerprint();
+    testConversionCache();
+    testLoadCWL();
+    testCWLJson();
     std::cout << "Success! Nothing failed!\n";
     return EXIT_SUCCESS;
 }
@@ -4,6 +4,7 @@
 
 #include <tdl/convertToCTD.h>
 #include <tdl/ToolInfo.h>
+#include <tdl/cwl_v1_2.h>
 
 /* This file, in combination with multiple_definition02_test.cpp are testing for multiple definition errors.
  * Since this is a header only library, many functions are marked with `inline`. To avoid missing an `inline`
@@ -4,5 +4,6 @@
 
 #include <tdl/convertToCTD.h>
 #include <tdl/ToolInfo.h>
+#include <tdl/cwl_v1_2.h>
 
 //! see multiple_definition01_test.cpp
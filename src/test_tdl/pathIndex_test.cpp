@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <stdexcept>
+#include <string>
+
+#include "utils.h"
+
+void testPathIndex() {
+    auto params = tdl::Node::Children{
+        {"algorithm",
+         "algorithm settings",
+         {},
+         tdl::Node::Children{
+             {"mz", "m/z settings", {}, tdl::Node::Children{{"tolerance", "a tolerance", {}, tdl::DoubleValue{0.1}}}},
+             {"threads", "number of threads", {}, tdl::IntValue{4}},
+         }},
+        {"input", "an input file", {"file"}, tdl::StringValue{"in.fa"}},
+        {"input", "a second parameter with the same name", {}, tdl::StringValue{"ignored"}},
+    };
+
+    { // lookup by full path
+        auto index = tdl::PathIndex{params};
+        assert(index.size() == 5);
+        auto & mz = std::get<tdl::Node::Children>(params[0].value)[0];
+        assert(index.find("algorithm:mz:tolerance") == &std::get<tdl::Node::Children>(mz.value)[0]);
+        assert(index.find("algorithm")->description == "algorithm settings");
+        assert(index.at("algorithm:threads").name == "threads");
+        assert(index.find("tolerance") == nullptr);
+        assert(index.find("algorithm:") == nullptr);
+        assert(index.find("") == nullptr);
+
+        // the first of several siblings with the same name is found
+        assert(index.at("input").description == "an input file");
+
+        // found nodes can be modified
+        std::get<tdl::DoubleValue>(index.at("algorithm:mz:tolerance").value).value = 0.5;
+        assert(std::get<tdl::DoubleValue>(index.at("algorithm:mz:tolerance").value).value == 0.5);
+
+        auto thrown = false;
+        try {
+            index.at("algorithm:unknown");
+        } catch (std::out_of_range const &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    { // invalidation after the children of a node changed
+        auto index     = tdl::PathIndex{params};
+        auto & section = std::get<tdl::Node::Children>(index.at("algorithm").value);
+
+        section.push_back({"verbose", "a flag", {}, tdl::BoolValue{true}});
+        section.erase(section.begin()); // removes "mz"
+        index.invalidate("algorithm");
+        assert(index.size() == 4);
+        assert(index.find("algorithm:mz") == nullptr);
+        assert(index.find("algorithm:mz:tolerance") == nullptr);
+        assert(index.at("algorithm:verbose").name == "verbose");
+        assert(index.at("algorithm:threads").name == "threads");
+        assert(index.at("input").name == "input");
+
+        // a node that no longer has children
+        index.at("algorithm").value = tdl::IntValue{1};
+        index.invalidate("algorithm");
+        assert(index.size() == 2);
+
+        // changes of the top level parameters re-index everything
+        params.push_back({"output", "an output file", {"file", "output"}, tdl::StringValue{"out.fa"}});
+        index.invalidate();
+        assert(index.size() == 3);
+        assert(index.at("output").name == "output");
+
+        auto thrown = false;
+        try {
+            index.invalidate("unknown");
+        } catch (std::out_of_range const &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    { // an index can be moved
+        auto index = tdl::PathIndex{params};
+        auto moved = std::move(index);
+        assert(moved.at("output").name == "output");
+        assert(tdl::PathIndex{}.size() == 0);
+    }
+}
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <string>
+#include <vector>
+
+#include <yaml-cpp/yaml.h>
+
+#include "utils.h"
+
+#if TDL_HAS_PMR
+
+namespace {
+
+//!\brief a tool using all value types, special tags and a nested section
+auto makeToolInfo() -> tdl::ToolInfo {
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.version        = "1.0.0";
+    doc.metaInfo.name           = "pmrTool";
+    doc.metaInfo.description    = "A tool with a rather long description, which does not fit into a small string.";
+    doc.metaInfo.executableName = "/usr/bin/pmrTool";
+    doc.metaInfo.citations      = {{"doi:123", "https://example.com/a/long/url/to/the/publication"}};
+
+    auto section = tdl::Node{"section", "a nested section", {}, tdl::Node::Children{}};
+    auto & children = std::get<tdl::Node::Children>(section.value);
+    children.push_back({"threshold", "a double", {}, tdl::DoubleValue{0.5, 0., 1.}});
+    children.push_back({"names", "a list of names", {"some custom tag"}, tdl::StringValueList{{"alpha", "beta"}}});
+
+    doc.params = {
+        {"flag", "a bool", {}, tdl::BoolValue{true}},
+        {"count", "an int", {"required", "default_as_hint"}, tdl::IntValue{5, 1, 10}},
+        {"mode", "a string with valid values", {}, tdl::StringValue{"fast", {{"fast", "a very slow mode"}}}},
+        {"input", "an input file", {"file", "required", "input file"}, tdl::StringValue{"in.fa", {{"*.fa"}}}},
+        {"output", "an output file", {"file", "output", "output file"}, tdl::StringValue{"out.fa"}},
+        {"ints", "a list of ints", {"advanced"}, tdl::IntValueList{{1, 2, 3}, 0, 4}},
+        {"doubles", "a list of doubles", {}, tdl::DoubleValueList{{1.5, 2.5}}},
+        section,
+    };
+    doc.cliMapping = {{"--flag", "flag"}, {"--count", "count"}, {"-i", "input"}, {"--names", "names"}};
+    return doc;
+}
+
+//!\brief true if all strings and lists of the subtree are allocated from `resource`
+auto allocatedFrom(tdl::pmr::Node const & node, std::pmr::memory_resource * resource) -> bool {
+    if (node.get_allocator().resource() != resource || node.description.get_allocator().resource() != resource
+        || node.tags.get_allocator().resource() != resource) {
+        return false;
+    }
+    if (auto children = std::get_if<tdl::pmr::Node::Children>(&node.value)) {
+        return children->get_allocator().resource() == resource
+               && std::all_of(children->begin(), children->end(), [&](auto const & child) {
+                      return allocatedFrom(child, resource);
+                  });
+    }
+    if (auto list = std::get_if<tdl::pmr::StringValueList>(&node.value)) {
+        return list->value.get_allocator().resource() == resource
+               && std::all_of(list->value.begin(), list->value.end(), [&](auto const & e) {
+                      return e.get_allocator().resource() == resource;
+                  });
+    }
+    return true;
+}
+
+} // namespace
+
+void testPmr() {
+    auto const doc = makeToolInfo();
+
+    { // the copy lives completely in the arena, no allocation goes to the default resource
+        auto arena    = std::pmr::monotonic_buffer_resource{std::pmr::new_delete_resource()};
+        auto previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+        auto pmrDoc   = tdl::pmr::ToolInfo{doc, &arena};
+        std::pmr::set_default_resource(previous);
+
+        assert(pmrDoc.get_allocator().resource() == &arena);
+        assert(pmrDoc.metaInfo.description.get_allocator().resource() == &arena);
+        assert(pmrDoc.cliMapping[0].referenceName.get_allocator().resource() == &arena);
+        for (auto const & param : pmrDoc.params) {
+            assert(allocatedFrom(param, &arena));
+        }
+        assert(pmrDoc.params[2].tags.empty());
+        assert(pmrDoc.params[3].tags.count(tdl::Tag::input_file) == 1);
+        assert(std::get<tdl::pmr::StringValue>(pmrDoc.params[2].value).validValues->size() == 2);
+    }
+
+    { // exports are identical to the ones of the original tool
+        auto arena  = std::pmr::monotonic_buffer_resource{};
+        auto pmrDoc = tdl::pmr::ToolInfo{doc, &arena};
+
+        assert(tdl::convertToCTD(pmrDoc) == tdl::convertToCTD(doc));
+        assert(tdl::convertToCWL(pmrDoc, {}) == tdl::convertToCWL(doc, {}));
+
+        auto options = tdl::CWLOptions{};
+        options.hooks.push_back([](YAML::Node & node) {
+            node["requirements"]["InlineJavascriptRequirement"] = YAML::Node{YAML::NodeType::Map};
+        });
+        assert(tdl::convertToCWL(pmrDoc, options) == tdl::convertToCWL(doc, options));
+
+        // and converting back yields the same tool
+        assert(tdl::convertToCTD(tdl::pmr::toToolInfo(pmrDoc)) == tdl::convertToCTD(doc));
+    }
+
+    { // nodes built from values, copies and moves into other resources
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        auto other = std::pmr::monotonic_buffer_resource{};
+
+        auto node = tdl::pmr::Node{"names",
+                                   "some names",
+                                   {"advanced", "custom"},
+                                   tdl::pmr::StringValueList{{"a", "long string that is allocated"}},
+                                   &arena};
+        assert(allocatedFrom(node, &arena));
+        assert(node.tags.count("custom") == 1);
+
+        auto copy = tdl::pmr::Node{node, &other};
+        assert(allocatedFrom(copy, &other));
+        assert(allocatedFrom(node, &arena));
+
+        auto moved = tdl::pmr::Node{std::move(copy), &arena};
+        assert(allocatedFrom(moved, &arena));
+        assert(std::get<tdl::pmr::StringValueList>(moved.value).value[1] == "long string that is allocated");
+
+        // children are constructed with the allocator of their parent
+        auto section = tdl::pmr::Node{&arena};
+        std::get<tdl::pmr::Node::Children>(section.value).push_back(tdl::pmr::Node{node, &other});
+        std::get<tdl::pmr::Node::Children>(section.value).emplace_back(doc.params[1]);
+        assert(allocatedFrom(section, &arena));
+
+        // assignments keep the allocator of the assigned node
+        auto target = tdl::pmr::Node{&other};
+        target      = section;
+        assert(allocatedFrom(target, &other));
+        target = tdl::pmr::Node{"count", "", {}, tdl::IntValue{3}, &arena};
+        assert(allocatedFrom(target, &other));
+        assert(std::get<tdl::IntValue>(target.value).value == 3);
+
+        assert(tdl::pmr::toNode(section).name.empty());
+        assert(std::get<tdl::Node::Children>(tdl::pmr::toNode(section).value).size() == 2);
+    }
+}
+
+#else
+
+void testPmr() {}
+
+#endif
@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+void testValidate() {
+    using tdl::ValidationMode;
+    using tdl::Violation;
+    using tdl::ViolationKind;
+
+    auto node = [](tdl::Node::Value value) { return tdl::Node{"value", "", {}, std::move(value)}; };
+
+    { // state() of single values and lists
+        using State = tdl::IntValue::State;
+        assert((tdl::IntValue{5, 1, 10}.state() == State::Ok));
+        assert((tdl::IntValue{0, 1, 10}.state() == State::ValueTooLow));
+        assert((tdl::IntValue{11, 1, 10}.state() == State::ValueTooHigh));
+        assert((tdl::IntValue{5, 10, 1}.state() == State::LimitsInvalid));
+
+        using ListState = tdl::IntValueList::State;
+        assert((tdl::IntValueList{{1, 5, 10}, 1, 10}.state() == ListState::Ok));
+        assert((tdl::IntValueList{{1, 0, 11}, 1, 10}.state() == ListState::ValueTooLow));
+        assert((tdl::IntValueList{{1, 11, 0}, 1, 10}.state() == ListState::ValueTooHigh));
+        assert((tdl::DoubleValueList{{0.5, 1.5}, 0.0, 1.0}.state() == tdl::DoubleValueList::State::ValueTooHigh));
+
+        using StringState = tdl::StringValue::State;
+        assert((tdl::StringValue{"a", {{"a", "b"}}}.state() == StringState::Valid));
+        assert((tdl::StringValue{"c", {{"a", "b"}}}.state() == StringState::Invalid));
+        assert((tdl::StringValue{"c"}.state() == StringState::Valid));
+
+        using StringListState = tdl::StringValueList::State;
+        assert((tdl::StringValueList{{"a", "b"}, {{"a", "b"}}}.state() == StringListState::Valid));
+        assert((tdl::StringValueList{{"a", "c"}, {{"a", "b"}}}.state() == StringListState::Invalid));
+    }
+
+    { // limits
+        assert(tdl::validateValue(node(tdl::IntValue{5, 1, 10})).empty());
+        assert(tdl::validateValue(node(tdl::IntValue{5})).empty());
+        assert((tdl::validateValue(node(tdl::IntValue{0, 1, 10}))
+                == std::vector<Violation>{{ViolationKind::ValueTooLow, 0}}));
+        assert((tdl::validateValue(node(tdl::DoubleValue{2.0, {}, 1.0}))
+                == std::vector<Violation>{{ViolationKind::ValueTooHigh, 0}}));
+        assert((tdl::validateValue(node(tdl::IntValueList{{20}, 10, 1}))
+                == std::vector<Violation>{{ViolationKind::LimitsInvalid, 0}}));
+        assert(tdl::isValid(node(tdl::BoolValue{true})));
+        assert(tdl::isValid(node(tdl::Node::Children{{"a", "", {}, tdl::IntValue{0, 1, 10}}})));
+    }
+
+    { // lists report the position of the first or of all violations
+        auto list = node(tdl::IntValueList{{5, 0, 7, 11, -3}, 1, 10});
+        assert((tdl::validateValue(list) == std::vector<Violation>{{ViolationKind::ValueTooLow, 1}}));
+        assert((tdl::validateValue(list, ValidationMode::AllViolations)
+                == std::vector<Violation>{{ViolationKind::ValueTooLow, 1},
+                                          {ViolationKind::ValueTooHigh, 3},
+                                          {ViolationKind::ValueTooLow, 4}}));
+        assert(tdl::isValid(node(tdl::IntValueList{{}, 1, 10})));
+
+        // NaNs never violate a limit
+        auto nan     = std::numeric_limits<double>::quiet_NaN();
+        auto doubles = node(tdl::DoubleValueList{{nan, 0.5, nan, 2.0}, 0.0, 1.0});
+        assert((tdl::validateValue(doubles) == std::vector<Violation>{{ViolationKind::ValueTooHigh, 3}}));
+        assert(tdl::isValid(node(tdl::DoubleValueList{{nan, 0.5}, 0.0, 1.0})));
+    }
+
+    { // valid values, short and hashed lists
+        assert(tdl::isValid(node(tdl::StringValue{"a", {{"a", "b"}}})));
+        assert((tdl::validateValue(node(tdl::StringValue{"c", {{"a", "b"}}}))
+                == std::vector<Violation>{{ViolationKind::InvalidValue, 0}}));
+
+        auto validValues = std::vector<std::string>{};
+        for (size_t i{0}; i <= tdl::ValidValueSet::hashThreshold; ++i) {
+            validValues.push_back("value" + std::to_string(i));
+        }
+        auto list = node(tdl::StringValueList{{"value0", "other", "value16", "value17"}, validValues});
+        assert((tdl::validateValue(list) == std::vector<Violation>{{ViolationKind::InvalidValue, 1}}));
+        assert((tdl::validateValue(list, ValidationMode::AllViolations)
+                == std::vector<Violation>{{ViolationKind::InvalidValue, 1}, {ViolationKind::InvalidValue, 3}}));
+
+        // the valid values of file parameters are their supported formats
+        for (auto tag : {"input file", "output file", "output prefix"}) {
+            assert(tdl::isValid(tdl::Node{"in", "", {tag}, tdl::StringValue{"reads.fasta", {{"*.fasta"}}}}));
+            assert(tdl::isValid(tdl::Node{"in", "", {tag}, tdl::StringValueList{{"reads.fasta"}, {{"*.fasta"}}}}));
+        }
+        auto tool       = tdl::ToolInfo{};
+        tool.params     = {{"in", "", {"input file", "required"}, tdl::StringValue{"reads.fasta", {{"*.fasta"}}}}};
+        tool.cliMapping = {{"--in", "in"}};
+        assert(tdl::validate(tool).empty());
+
+        auto set = tdl::ValidValueSet{validValues};
+        assert(set.contains("value16") && !set.contains("value"));
+        auto shortValues = std::vector<std::string>{"a", "b"};
+        auto shortSet    = tdl::ValidValueSet{shortValues};
+        assert(shortSet.contains("b") && !shortSet.contains("c"));
+    }
+
+    { // whole tool
+        using tdl::Diagnostic;
+        using tdl::DiagnosticKind;
+
+        auto deep = tdl::Node{"level6", "", {}, tdl::IntValue{1}};
+        for (auto level : {"level5", "level4", "level3", "level2", "level1"}) {
+            deep = tdl::Node{level, "", {}, tdl::Node::Children{deep}};
+        }
+
+        auto doc   = tdl::ToolInfo{};
+        doc.params = {
+            {"threads", "", {}, tdl::IntValue{0, 1, 64}},
+            {"files", "", {"output", "prefixed"}, tdl::StringValueList{}},
+            {"names", "", {"output"}, tdl::StringValueList{}},
+            {"tool",
+             "",
+             {"basecommand"},
+             tdl::Node::Children{
+                 {"mode", "", {}, tdl::StringValue{"fast", {{"fast", "slow"}}}},
+                 {"mode", "", {}, tdl::StringValue{"unknown", {{"fast", "slow"}}}},
+                 {"log", "", {"output"}, tdl::StringValue{}},
+                 {"section", "", {}, tdl::Node::Children{{"out", "", {"output", "file"}, tdl::StringValue{}}}},
+             }},
+            deep,
+        };
+        doc.cliMapping = {{"--threads", "threads"}, {"--unknown", "unknown"}, {"--out", "out"},
+                          {"--deep", "level6"},     {"-t", "threads"},         {"-u", "unknown"}};
+
+        auto diagnostics = tdl::validate(doc);
+        assert((diagnostics
+                == std::vector<Diagnostic>{
+                    {DiagnosticKind::ValueTooLow, "threads", 0},
+                    {DiagnosticKind::OutputDropped, "names", 0},
+                    {DiagnosticKind::DuplicateName, "tool:mode", 0},
+                    {DiagnosticKind::InvalidValue, "tool:mode", 0},
+                    {DiagnosticKind::OutputDropped, "tool:log", 0},
+                    {DiagnosticKind::OutputDropped, "tool:section:out", 0},
+                    {DiagnosticKind::TooDeep, "level1:level2:level3:level4:level5:level6", 0},
+                    {DiagnosticKind::UnknownCLIMapping, "unknown", 1},
+                    {DiagnosticKind::DuplicateCLIMapping, "threads", 4},
+                    {DiagnosticKind::UnknownCLIMapping, "unknown", 5},
+                    {DiagnosticKind::DuplicateCLIMapping, "unknown", 5},
+                }));
+
+        // convertToCWL throws for the mappings validate reports as duplicates
+        auto threw = false;
+        try {
+            tdl::convertToCWL(doc);
+        } catch (std::runtime_error const &) {
+            threw = true;
+        }
+        assert(threw);
+
+        // all violations of a list
+        doc.params     = {{"sizes", "", {}, tdl::IntValueList{{0, 5, 100}, 1, 10}}};
+        doc.cliMapping = {};
+        assert((tdl::validate(doc, ValidationMode::AllViolations)
+                == std::vector<Diagnostic>{{DiagnosticKind::ValueTooLow, "sizes", 0},
+                                           {DiagnosticKind::ValueTooHigh, "sizes", 2}}));
+        assert(tdl::validate(tdl::ToolInfo{}).empty());
+
+        // many siblings are checked through a hash set
+        doc.params.clear();
+        for (size_t i{0}; i < 20; ++i) {
+            doc.params.push_back({"p" + std::to_string(i % 19), "", {}, tdl::BoolValue{}});
+        }
+        assert((tdl::validate(doc) == std::vector<Diagnostic>{{DiagnosticKind::DuplicateName, "p0", 0}}));
+    }
+
+#if TDL_HAS_PMR
+    { // pmr values
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        auto list  = tdl::pmr::Node{node(tdl::StringValueList{{"a", "c"}, {{"a", "b"}}}), &arena};
+        assert((tdl::validateValue(list) == std::vector<Violation>{{ViolationKind::InvalidValue, 1}}));
+
+        auto ints = tdl::pmr::Node{node(tdl::IntValueList{{1, 2, 30}, {}, 10}), &arena};
+        assert((tdl::validateValue(ints) == std::vector<Violation>{{ViolationKind::ValueTooHigh, 2}}));
+
+        auto doc       = tdl::ToolInfo{};
+        doc.params     = {{"threads", "", {}, tdl::IntValue{0, 1, 64}}};
+        doc.cliMapping = {{"--unknown", "unknown"}};
+        assert((tdl::validate(tdl::pmr::ToolInfo{doc, &arena})
+                == std::vector<tdl::Diagnostic>{{tdl::DiagnosticKind::ValueTooLow, "threads", 0},
+                                                {tdl::DiagnosticKind::UnknownCLIMapping, "unknown", 0}}));
+    }
+#endif
+}
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+//!\brief how a YAML parser resolves a scalar: 's'tring, '0' for null, 'b'ool or 'n'umber, quoted scalars are strings
+inline auto scalarKind(YAML::Node const & node) -> char {
+    if (node.Tag() == "!") {
+        return 's';
+    }
+    auto const & text = node.Scalar();
+    if (text == "null" || text == "~" || text.empty()) {
+        return '0';
+    }
+    if (text == "true" || text == "false") {
+        return 'b';
+    }
+    auto number = double{};
+    return YAML::convert<double>::decode(node, number) ? 'n' : 's';
+}
+
+/*!\brief compares two YAML trees, maps in order
+ *
+ * Scalars are equal if they have the same text and kind, a quoted ".inf" is no number, but quoted and plain
+ * strings are the same string.
+ */
+inline auto equalNodes(YAML::Node const & lhs, YAML::Node const & rhs) -> bool {
+    if (lhs.Type() != rhs.Type()) {
+        return false;
+    }
+    if (lhs.IsScalar()) {
+        return lhs.Scalar() == rhs.Scalar() && scalarKind(lhs) == scalarKind(rhs);
+    }
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    auto r = rhs.begin();
+    for (auto l = lhs.begin(); l != lhs.end(); ++l, ++r) {
+        if (lhs.IsMap()) {
+            if (!equalNodes(l->first, r->first) || !equalNodes(l->second, r->second)) {
+                return false;
+            }
+        } else if (!equalNodes(*l, *r)) {
+            return false;
+        }
+    }
+    return true;
+}